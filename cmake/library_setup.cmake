@@ -39,3 +39,9 @@ target_compile_options(${PROJECT_NAME}
 target_compile_definitions(${PROJECT_NAME}
     INTERFACE ${JSONIFIER_COMPILE_DEFINITIONS}
 )
+
+find_package(Threads REQUIRED)
+
+target_link_libraries(${PROJECT_NAME}
+    INTERFACE Threads::Threads
+)
@@ -48,6 +48,13 @@ namespace jsonifier::internal {
 		}
 	}
 
+#if JSONIFIER_TRACK_ALLOCATIONS
+	struct allocation_counter {
+		inline static std::atomic<uint64_t> allocations{};
+		inline static std::atomic<uint64_t> deallocations{};
+	};
+#endif
+
 	template<typename value_type_new> class alloc_wrapper {
 	  public:
 		using value_type	   = value_type_new;
@@ -72,6 +79,9 @@ namespace jsonifier::internal {
 			if JSONIFIER_UNLIKELY (count == 0) {
 				return nullptr;
 			}
+#if JSONIFIER_TRACK_ALLOCATIONS
+			allocation_counter::allocations.fetch_add(1, std::memory_order_relaxed);
+#endif
 			const size_type bytes		 = count * sizeof(value_type);
 			const size_type alignedBytes = roundUpToMultiple<alignment>(bytes);
 			if (alignedBytes >= hugePageThreshold) {
@@ -113,6 +123,9 @@ namespace jsonifier::internal {
 
 		JSONIFIER_INLINE void deallocate(pointer p, size_type count) noexcept {
 			if JSONIFIER_LIKELY (p) {
+#if JSONIFIER_TRACK_ALLOCATIONS
+				allocation_counter::deallocations.fetch_add(1, std::memory_order_relaxed);
+#endif
 				const size_type bytes		 = count * sizeof(value_type);
 				const size_type alignedBytes = roundUpToMultiple<alignment>(bytes);
 				if (alignedBytes >= hugePageThreshold) {
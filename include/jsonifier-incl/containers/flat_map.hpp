@@ -0,0 +1,306 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// https://github.com/RealTimeChris/jsonifier
+
+#pragma once
+
+#include <jsonifier-incl/core/config.hpp>
+#include <jsonifier-incl/utilities/simd.hpp>
+#include <jsonifier-incl/utilities/hash.hpp>
+#include <initializer_list>
+#include <functional>
+#include <vector>
+
+namespace jsonifier::internal {
+
+	struct flat_key_index {
+		static constexpr uint64_t hashThreshold{ 24 };
+		static constexpr uint32_t emptySlot{ std::numeric_limits<uint32_t>::max() };
+		static constexpr rt_seeded_key_hasher hasher{ 0x9E3779B97F4A7C15ull };
+
+		JSONIFIER_INLINE static uint8_t tag(string_view_ptr data, uint64_t length) noexcept {
+			return static_cast<uint8_t>((length > 0 ? static_cast<uint8_t>(data[0]) : 0u) ^ (length * 0x25u));
+		}
+
+		JSONIFIER_INLINE static uint64_t hash(string_view_ptr data, uint64_t length) noexcept {
+			return hasher.hashKeyRt(data, length) ^ length;
+		}
+
+		template<typename matcher_type> JSONIFIER_INLINE static uint64_t scan(const uint8_t* tags, uint64_t count, uint8_t tagNew, matcher_type&& matcher) noexcept {
+			uint64_t index{};
+			if (count >= 16) {
+				const auto tagVector = simd::gatherValue<jsonifier_simd_int_128>(tagNew);
+				for (; index + 16 <= count; index += 16) {
+					uint32_t mask = static_cast<uint32_t>(simd::opCmpEqBitMask(simd::gatherValuesU<jsonifier_simd_int_128>(tags + index), tagVector));
+					while (mask != 0) {
+						const uint64_t position = index + simd::tzcnt(mask);
+						if (matcher(position)) {
+							return position;
+						}
+						mask &= mask - 1;
+					}
+				}
+			}
+			for (; index < count; ++index) {
+				if (tags[index] == tagNew && matcher(index)) {
+					return index;
+				}
+			}
+			return count;
+		}
+
+		JSONIFIER_INLINE static uint64_t slotCount(uint64_t count) noexcept {
+			uint64_t slotCountNew{ 32 };
+			while (slotCountNew < count * 2) {
+				slotCountNew *= 2;
+			}
+			return slotCountNew;
+		}
+
+		JSONIFIER_INLINE static void insert(uint32_t* slots, uint64_t slotCountNew, uint64_t hashNew, uint32_t index) noexcept {
+			uint64_t slot = hashNew & (slotCountNew - 1);
+			while (slots[slot] != emptySlot) {
+				slot = (slot + 1) & (slotCountNew - 1);
+			}
+			slots[slot] = index;
+		}
+
+		template<typename matcher_type>
+		JSONIFIER_INLINE static uint64_t probe(const uint32_t* slots, uint64_t slotCountNew, uint64_t hashNew, uint64_t count, matcher_type&& matcher) noexcept {
+			uint64_t slot = hashNew & (slotCountNew - 1);
+			while (slots[slot] != emptySlot) {
+				if (matcher(slots[slot])) {
+					return slots[slot];
+				}
+				slot = (slot + 1) & (slotCountNew - 1);
+			}
+			return count;
+		}
+	};
+
+	template<typename key_type, bool = std::is_convertible_v<const key_type&, std::string_view>> struct map_key_traits {
+		using view_type = std::string_view;
+
+		JSONIFIER_INLINE static uint8_t tag(view_type key) noexcept {
+			return flat_key_index::tag(key.data(), key.size());
+		}
+
+		JSONIFIER_INLINE static uint64_t hash(view_type key) noexcept {
+			return flat_key_index::hash(key.data(), key.size());
+		}
+
+		JSONIFIER_INLINE static uint64_t hash(view_type key, uint64_t seed) noexcept {
+			const uint64_t hashNew = rt_seeded_key_hasher{ seed }.hashKeyRt(key.data(), key.size()) ^ key.size();
+			return (hashNew ^ (hashNew >> 29)) * 0xBF58476D1CE4E5B9ull;
+		}
+	};
+
+	template<typename key_type> struct map_key_traits<key_type, false> {
+		using view_type = const key_type&;
+
+		JSONIFIER_INLINE static uint64_t hash(view_type key) noexcept {
+			return static_cast<uint64_t>(std::hash<key_type>{}(key)) * 0x9E3779B97F4A7C15ull;
+		}
+
+		JSONIFIER_INLINE static uint64_t hash(view_type key, uint64_t seed) noexcept {
+			const uint64_t hashNew = (static_cast<uint64_t>(std::hash<key_type>{}(key)) ^ seed) * 0x9E3779B97F4A7C15ull;
+			return (hashNew ^ (hashNew >> 29)) * 0xBF58476D1CE4E5B9ull;
+		}
+
+		JSONIFIER_INLINE static uint8_t tag(view_type key) noexcept {
+			return static_cast<uint8_t>(hash(key) >> 56);
+		}
+	};
+
+}
+
+namespace jsonifier {
+
+	template<typename key_type_new, typename mapped_type_new> class flat_map {
+	  public:
+		using key_type		   = key_type_new;
+		using mapped_type	   = mapped_type_new;
+		using value_type	   = std::pair<key_type, mapped_type>;
+		using size_type		   = uint64_t;
+		using difference_type  = std::ptrdiff_t;
+		using reference		   = value_type&;
+		using const_reference  = const value_type&;
+		using iterator		   = typename std::vector<value_type>::iterator;
+		using const_iterator   = typename std::vector<value_type>::const_iterator;
+		using key_traits	   = internal::map_key_traits<key_type>;
+		using key_view_type	   = typename key_traits::view_type;
+
+		JSONIFIER_INLINE flat_map() noexcept = default;
+
+		JSONIFIER_INLINE flat_map(std::initializer_list<value_type> values) {
+			reserve(values.size());
+			for (const auto& value: values) {
+				insert(value);
+			}
+		}
+
+		JSONIFIER_INLINE iterator begin() noexcept {
+			return entries.begin();
+		}
+
+		JSONIFIER_INLINE const_iterator begin() const noexcept {
+			return entries.begin();
+		}
+
+		JSONIFIER_INLINE iterator end() noexcept {
+			return entries.end();
+		}
+
+		JSONIFIER_INLINE const_iterator end() const noexcept {
+			return entries.end();
+		}
+
+		JSONIFIER_INLINE size_type size() const noexcept {
+			return entries.size();
+		}
+
+		JSONIFIER_INLINE bool empty() const noexcept {
+			return entries.empty();
+		}
+
+		JSONIFIER_INLINE void reserve(size_type count) {
+			entries.reserve(count);
+			tags.reserve(count);
+		}
+
+		JSONIFIER_INLINE void clear() noexcept {
+			entries.clear();
+			tags.clear();
+			slots.clear();
+		}
+
+		template<typename key_type_newer>
+			requires(std::is_convertible_v<const key_type_newer&, key_view_type>)
+		JSONIFIER_INLINE iterator find(const key_type_newer& key) noexcept {
+			return entries.begin() + static_cast<difference_type>(findIndex(key));
+		}
+
+		template<typename key_type_newer>
+			requires(std::is_convertible_v<const key_type_newer&, key_view_type>)
+		JSONIFIER_INLINE const_iterator find(const key_type_newer& key) const noexcept {
+			return entries.begin() + static_cast<difference_type>(findIndex(key));
+		}
+
+		template<typename key_type_newer>
+			requires(std::is_convertible_v<const key_type_newer&, key_view_type>)
+		JSONIFIER_INLINE bool contains(const key_type_newer& key) const noexcept {
+			return findIndex(key) != entries.size();
+		}
+
+		template<typename key_type_newer, typename... arg_types>
+			requires(std::is_constructible_v<key_type, key_type_newer&&> && std::is_convertible_v<const key_type_newer&, key_view_type>)
+		JSONIFIER_INLINE std::pair<iterator, bool> try_emplace(key_type_newer&& key, arg_types&&... args) {
+			const size_type index = findIndex(key);
+			if (index != entries.size()) {
+				return { entries.begin() + static_cast<difference_type>(index), false };
+			}
+			const uint8_t tagNew = key_traits::tag(key);
+			entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(std::forward<key_type_newer>(key)), std::forward_as_tuple(std::forward<arg_types>(args)...));
+			tags.emplace_back(tagNew);
+			appendIndex();
+			return { entries.end() - 1, true };
+		}
+
+		JSONIFIER_INLINE std::pair<iterator, bool> insert(const value_type& value) {
+			return try_emplace(value.first, value.second);
+		}
+
+		JSONIFIER_INLINE std::pair<iterator, bool> insert(value_type&& value) {
+			return try_emplace(std::move(value.first), std::move(value.second));
+		}
+
+		JSONIFIER_INLINE mapped_type& operator[](const key_type& key) {
+			return try_emplace(key).first->second;
+		}
+
+		JSONIFIER_INLINE mapped_type& operator[](key_type&& key) {
+			return try_emplace(std::move(key)).first->second;
+		}
+
+		JSONIFIER_INLINE iterator erase(const_iterator position) {
+			const auto index = static_cast<size_type>(position - entries.cbegin());
+			tags.erase(tags.begin() + static_cast<difference_type>(index));
+			const auto result = entries.erase(position);
+			rebuildIndex();
+			return result;
+		}
+
+		template<typename key_type_newer>
+			requires(std::is_convertible_v<const key_type_newer&, key_view_type>)
+		JSONIFIER_INLINE size_type erase(const key_type_newer& key) {
+			const size_type index = findIndex(key);
+			if (index == entries.size()) {
+				return 0;
+			}
+			erase(entries.cbegin() + static_cast<difference_type>(index));
+			return 1;
+		}
+
+		JSONIFIER_INLINE bool operator==(const flat_map& other) const {
+			return entries == other.entries;
+		}
+
+	  protected:
+		std::vector<value_type> entries{};
+		std::vector<uint8_t> tags{};
+		std::vector<uint32_t> slots{};
+
+		JSONIFIER_INLINE size_type findIndex(key_view_type key) const noexcept {
+			const auto matcher = [&](uint64_t index) {
+				return key_view_type{ entries[index].first } == key;
+			};
+			if (slots.empty()) {
+				return internal::flat_key_index::scan(tags.data(), entries.size(), key_traits::tag(key), matcher);
+			}
+			return internal::flat_key_index::probe(slots.data(), slots.size(), key_traits::hash(key), entries.size(), matcher);
+		}
+
+		JSONIFIER_INLINE void appendIndex() {
+			if (entries.size() < internal::flat_key_index::hashThreshold) {
+				return;
+			}
+			if (entries.size() * 2 > slots.size()) {
+				rebuildIndex();
+				return;
+			}
+			internal::flat_key_index::insert(slots.data(), slots.size(), key_traits::hash(entries.back().first), static_cast<uint32_t>(entries.size() - 1));
+		}
+
+		JSONIFIER_INLINE void rebuildIndex() {
+			slots.clear();
+			if (entries.size() < internal::flat_key_index::hashThreshold) {
+				return;
+			}
+			slots.resize(internal::flat_key_index::slotCount(entries.size()), internal::flat_key_index::emptySlot);
+			for (size_type x = 0; x < entries.size(); ++x) {
+				internal::flat_key_index::insert(slots.data(), slots.size(), key_traits::hash(entries[x].first), static_cast<uint32_t>(x));
+			}
+		}
+	};
+
+}
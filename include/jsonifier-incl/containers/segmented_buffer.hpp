@@ -0,0 +1,176 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// https://github.com/RealTimeChris/jsonifier
+#pragma once
+
+#include <jsonifier-incl/containers/allocator.hpp>
+#include <jsonifier-incl/utilities/concepts.hpp>
+#include <vector>
+
+namespace jsonifier {
+
+#if JSONIFIER_PLATFORM_WINDOWS
+	struct io_vector {
+		void* iov_base;
+		size_t iov_len;
+	};
+#else
+	using io_vector = iovec;
+#endif
+
+	namespace internal {
+
+		template<typename buffer_type> struct serialize_segment_context;
+
+	}
+
+	template<uint64_t segmentSizeNew = 4 * 1024 * 1024ULL> class segmented_buffer : protected internal::alloc_wrapper<char> {
+	  public:
+		template<typename buffer_type> friend struct internal::serialize_segment_context;
+
+		using allocator = internal::alloc_wrapper<char>;
+
+		static constexpr uint64_t segmentSize{ segmentSizeNew };
+		static constexpr uint64_t segmentSlack{ 64 };
+
+		static_assert(segmentSize > segmentSlack * 2, "segmented_buffer segments must be larger than 128 bytes.");
+
+		segmented_buffer& operator=(const segmented_buffer&) = delete;
+		segmented_buffer(const segmented_buffer&)			 = delete;
+
+		JSONIFIER_INLINE segmented_buffer() noexcept = default;
+
+		JSONIFIER_INLINE segmented_buffer& operator=(segmented_buffer&& other) noexcept {
+			if JSONIFIER_LIKELY (this != &other) {
+				release();
+				std::swap(segments, other.segments);
+				std::swap(ioVectors, other.ioVectors);
+				std::swap(currentIndex, other.currentIndex);
+				std::swap(markPtr, other.markPtr);
+				std::swap(sizeVal, other.sizeVal);
+			}
+			return *this;
+		}
+
+		JSONIFIER_INLINE segmented_buffer(segmented_buffer&& other) noexcept {
+			*this = internal::move(other);
+		}
+
+		JSONIFIER_INLINE const io_vector* iovecs() const noexcept {
+			return ioVectors.data();
+		}
+
+		JSONIFIER_INLINE uint64_t segmentCount() const noexcept {
+			return ioVectors.size();
+		}
+
+		JSONIFIER_INLINE uint64_t size() const noexcept {
+			return sizeVal;
+		}
+
+		JSONIFIER_INLINE void clear() noexcept {
+			ioVectors.clear();
+			currentIndex = 0;
+			markPtr		 = nullptr;
+			sizeVal		 = 0;
+		}
+
+		template<concepts::buffer_like buffer_type> JSONIFIER_INLINE void copyTo(buffer_type& buffer) const noexcept {
+			buffer.resize(sizeVal);
+			uint64_t index{};
+			for (auto& value: ioVectors) {
+				std::memcpy(buffer.data() + index, value.iov_base, value.iov_len);
+				index += value.iov_len;
+			}
+		}
+
+		JSONIFIER_INLINE ~segmented_buffer() noexcept {
+			release();
+		}
+
+	  protected:
+		struct segment {
+			char* data{};
+			uint64_t capacity{};
+		};
+
+		std::vector<io_vector> ioVectors{};
+		std::vector<segment> segments{};
+		uint64_t currentIndex{};
+		char* markPtr{};
+		uint64_t sizeVal{};
+
+		JSONIFIER_INLINE char* begin() noexcept {
+			clear();
+			markPtr = acquire(0, 0);
+			return markPtr;
+		}
+
+		JSONIFIER_INLINE uint64_t remaining(const char* ptr) const noexcept {
+			const auto& current = segments[currentIndex];
+			return static_cast<uint64_t>((current.data + current.capacity - segmentSlack) - ptr);
+		}
+
+		JSONIFIER_INLINE void seal(char* ptr) noexcept {
+			const auto length = static_cast<uint64_t>(ptr - markPtr);
+			if (length > 0) {
+				ioVectors.emplace_back(io_vector{ markPtr, static_cast<size_t>(length) });
+				sizeVal += length;
+				markPtr = ptr;
+			}
+		}
+
+		JSONIFIER_INLINE void external(char* ptr, const char* data, uint64_t size) noexcept {
+			seal(ptr);
+			ioVectors.emplace_back(io_vector{ const_cast<char*>(data), static_cast<size_t>(size) });
+			sizeVal += size;
+		}
+
+		JSONIFIER_INLINE char* advance(char* ptr, uint64_t additional) noexcept {
+			seal(ptr);
+			markPtr = acquire(currentIndex + 1, additional);
+			return markPtr;
+		}
+
+		JSONIFIER_INLINE char* acquire(uint64_t index, uint64_t additional) noexcept {
+			const uint64_t capacityNeeded = additional + segmentSlack * 2 > segmentSize ? internal::roundUpToMultiple<segmentSize>(additional + segmentSlack * 2) : segmentSize;
+			if (index == segments.size()) {
+				segments.emplace_back(segment{ allocator::allocate(capacityNeeded), capacityNeeded });
+			} else if (segments[index].capacity < capacityNeeded) {
+				allocator::deallocate(segments[index].data, segments[index].capacity);
+				segments[index] = segment{ allocator::allocate(capacityNeeded), capacityNeeded };
+			}
+			currentIndex = index;
+			return segments[index].data;
+		}
+
+		JSONIFIER_INLINE void release() noexcept {
+			for (auto& value: segments) {
+				allocator::deallocate(value.data, value.capacity);
+			}
+			segments.clear();
+			clear();
+		}
+	};
+
+}
@@ -0,0 +1,326 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// https://github.com/RealTimeChris/jsonifier
+
+#pragma once
+
+#include <jsonifier-incl/containers/flat_map.hpp>
+#include <chrono>
+
+namespace jsonifier::internal {
+
+	struct control_bytes {
+		static constexpr uint8_t empty{ 0x80 };
+		static constexpr uint8_t deleted{ 0xFE };
+		static constexpr uint64_t groupSize{ 16 };
+
+		JSONIFIER_INLINE static uint32_t match(const uint8_t* group, uint8_t value) noexcept {
+			return static_cast<uint32_t>(simd::opCmpEqBitMask(simd::gatherValuesU<jsonifier_simd_int_128>(group), simd::gatherValue<jsonifier_simd_int_128>(value)));
+		}
+
+		JSONIFIER_INLINE static uint32_t matchEmpty(const uint8_t* group) noexcept {
+			return match(group, empty);
+		}
+
+		JSONIFIER_INLINE static uint32_t matchAvailable(const uint8_t* group) noexcept {
+			return match(group, empty) | match(group, deleted);
+		}
+
+		JSONIFIER_INLINE static uint64_t randomSeed() noexcept {
+			static const uint64_t processSeed{ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) ^
+				static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&processSeed)) };
+			thread_local uint64_t counter{};
+			uint64_t seed = processSeed + (++counter * 0x9E3779B97F4A7C15ull) + static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&counter));
+			seed		  = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ull;
+			seed		  = (seed ^ (seed >> 27)) * 0x94D049BB133111EBull;
+			return seed ^ (seed >> 31);
+		}
+	};
+
+}
+
+namespace jsonifier {
+
+	template<typename key_type_new, typename mapped_type_new> class unordered_map {
+	  public:
+		using key_type		  = key_type_new;
+		using mapped_type	  = mapped_type_new;
+		using value_type	  = std::pair<key_type, mapped_type>;
+		using size_type		  = uint64_t;
+		using difference_type = std::ptrdiff_t;
+		using reference		  = value_type&;
+		using const_reference = const value_type&;
+		using iterator		  = typename std::vector<value_type>::iterator;
+		using const_iterator  = typename std::vector<value_type>::const_iterator;
+		using key_traits	  = internal::map_key_traits<key_type>;
+		using key_view_type	  = typename key_traits::view_type;
+
+		JSONIFIER_INLINE unordered_map() noexcept = default;
+
+		JSONIFIER_INLINE unordered_map(std::initializer_list<value_type> values) {
+			reserve(values.size());
+			for (const auto& value: values) {
+				insert(value);
+			}
+		}
+
+		JSONIFIER_INLINE iterator begin() noexcept {
+			return entries.begin();
+		}
+
+		JSONIFIER_INLINE const_iterator begin() const noexcept {
+			return entries.begin();
+		}
+
+		JSONIFIER_INLINE iterator end() noexcept {
+			return entries.end();
+		}
+
+		JSONIFIER_INLINE const_iterator end() const noexcept {
+			return entries.end();
+		}
+
+		JSONIFIER_INLINE size_type size() const noexcept {
+			return entries.size();
+		}
+
+		JSONIFIER_INLINE bool empty() const noexcept {
+			return entries.empty();
+		}
+
+		JSONIFIER_INLINE size_type capacity() const noexcept {
+			return slots.size();
+		}
+
+		JSONIFIER_INLINE void reserve(size_type count) {
+			entries.reserve(count);
+			if (count + tombstones > maxLoad(slots.size())) {
+				rehash(slotCountFor(count));
+			}
+		}
+
+		JSONIFIER_INLINE void clear() noexcept {
+			entries.clear();
+			std::fill(controls.begin(), controls.end(), internal::control_bytes::empty);
+			tombstones = 0;
+		}
+
+		template<typename key_type_newer>
+			requires(std::is_convertible_v<const key_type_newer&, key_view_type>)
+		JSONIFIER_INLINE iterator find(const key_type_newer& key) noexcept {
+			return entries.begin() + static_cast<difference_type>(findIndex(key));
+		}
+
+		template<typename key_type_newer>
+			requires(std::is_convertible_v<const key_type_newer&, key_view_type>)
+		JSONIFIER_INLINE const_iterator find(const key_type_newer& key) const noexcept {
+			return entries.begin() + static_cast<difference_type>(findIndex(key));
+		}
+
+		template<typename key_type_newer>
+			requires(std::is_convertible_v<const key_type_newer&, key_view_type>)
+		JSONIFIER_INLINE bool contains(const key_type_newer& key) const noexcept {
+			return findIndex(key) != entries.size();
+		}
+
+		template<typename key_type_newer, typename... arg_types>
+			requires(std::is_constructible_v<key_type, key_type_newer&&> && std::is_convertible_v<const key_type_newer&, key_view_type>)
+		JSONIFIER_INLINE std::pair<iterator, bool> try_emplace(key_type_newer&& key, arg_types&&... args) {
+			if JSONIFIER_UNLIKELY (entries.size() + tombstones + 1 > maxLoad(slots.size())) {
+				rehash(slotCountFor(entries.size() + 1));
+			}
+			const uint64_t hashNew = key_traits::hash(key, seed);
+			const uint8_t control  = static_cast<uint8_t>(hashNew & 0x7F);
+			const uint64_t mask	   = groupMask();
+			uint64_t group		   = (hashNew >> 7) & mask;
+			uint64_t available	   = slots.size();
+			for (uint64_t probe = 1;; ++probe) {
+				const uint8_t* groupPtr = controls.data() + group * internal::control_bytes::groupSize;
+				uint32_t matches		= internal::control_bytes::match(groupPtr, control);
+				while (matches != 0) {
+					const uint64_t slot = group * internal::control_bytes::groupSize + simd::tzcnt(matches);
+					if (key_view_type{ entries[slots[slot]].first } == key_view_type{ key }) {
+						return { entries.begin() + static_cast<difference_type>(slots[slot]), false };
+					}
+					matches &= matches - 1;
+				}
+				if (available == slots.size()) {
+					if (const uint32_t free = internal::control_bytes::matchAvailable(groupPtr); free != 0) {
+						available = group * internal::control_bytes::groupSize + simd::tzcnt(free);
+					}
+				}
+				if JSONIFIER_LIKELY (internal::control_bytes::matchEmpty(groupPtr) != 0) {
+					break;
+				}
+				group = (group + probe) & mask;
+			}
+			tombstones -= controls[available] == internal::control_bytes::deleted;
+			controls[available] = control;
+			slots[available]	= static_cast<uint32_t>(entries.size());
+			entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(std::forward<key_type_newer>(key)), std::forward_as_tuple(std::forward<arg_types>(args)...));
+			return { entries.end() - 1, true };
+		}
+
+		JSONIFIER_INLINE std::pair<iterator, bool> insert(const value_type& value) {
+			return try_emplace(value.first, value.second);
+		}
+
+		JSONIFIER_INLINE std::pair<iterator, bool> insert(value_type&& value) {
+			return try_emplace(std::move(value.first), std::move(value.second));
+		}
+
+		JSONIFIER_INLINE mapped_type& operator[](const key_type& key) {
+			return try_emplace(key).first->second;
+		}
+
+		JSONIFIER_INLINE mapped_type& operator[](key_type&& key) {
+			return try_emplace(std::move(key)).first->second;
+		}
+
+		JSONIFIER_INLINE iterator erase(const_iterator position) {
+			const auto index = static_cast<size_type>(position - entries.cbegin());
+			const auto last	 = entries.size() - 1;
+			controls[findSlot(entries[index].first, index)] = internal::control_bytes::deleted;
+			++tombstones;
+			if (index != last) {
+				slots[findSlot(entries[last].first, last)] = static_cast<uint32_t>(index);
+				entries[index]							   = std::move(entries[last]);
+			}
+			entries.pop_back();
+			return entries.begin() + static_cast<difference_type>(index);
+		}
+
+		template<typename key_type_newer>
+			requires(std::is_convertible_v<const key_type_newer&, key_view_type>)
+		JSONIFIER_INLINE size_type erase(const key_type_newer& key) {
+			const size_type index = findIndex(key);
+			if (index == entries.size()) {
+				return 0;
+			}
+			erase(entries.cbegin() + static_cast<difference_type>(index));
+			return 1;
+		}
+
+		JSONIFIER_INLINE bool operator==(const unordered_map& other) const {
+			if (entries.size() != other.entries.size()) {
+				return false;
+			}
+			for (const auto& value: entries) {
+				const auto iter = other.find(value.first);
+				if (iter == other.end() || !(iter->second == value.second)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+	  protected:
+		std::vector<value_type> entries{};
+		std::vector<uint8_t> controls{};
+		std::vector<uint32_t> slots{};
+		uint64_t tombstones{};
+		uint64_t seed{ internal::control_bytes::randomSeed() };
+
+		JSONIFIER_INLINE static size_type maxLoad(size_type slotCount) noexcept {
+			return slotCount - slotCount / 8;
+		}
+
+		JSONIFIER_INLINE static size_type slotCountFor(size_type count) noexcept {
+			size_type slotCount{ internal::control_bytes::groupSize };
+			while (maxLoad(slotCount) < count) {
+				slotCount *= 2;
+			}
+			return slotCount;
+		}
+
+		JSONIFIER_INLINE uint64_t groupMask() const noexcept {
+			return slots.size() / internal::control_bytes::groupSize - 1;
+		}
+
+		JSONIFIER_INLINE size_type findIndex(key_view_type key) const noexcept {
+			if JSONIFIER_UNLIKELY (slots.empty()) {
+				return entries.size();
+			}
+			const uint64_t hashNew = key_traits::hash(key, seed);
+			const uint8_t control  = static_cast<uint8_t>(hashNew & 0x7F);
+			const uint64_t mask	   = groupMask();
+			uint64_t group		   = (hashNew >> 7) & mask;
+			for (uint64_t probe = 1;; ++probe) {
+				const uint8_t* groupPtr = controls.data() + group * internal::control_bytes::groupSize;
+				uint32_t matches		= internal::control_bytes::match(groupPtr, control);
+				while (matches != 0) {
+					const uint64_t slot = group * internal::control_bytes::groupSize + simd::tzcnt(matches);
+					if JSONIFIER_LIKELY (key_view_type{ entries[slots[slot]].first } == key) {
+						return slots[slot];
+					}
+					matches &= matches - 1;
+				}
+				if JSONIFIER_LIKELY (internal::control_bytes::matchEmpty(groupPtr) != 0 || probe > mask) {
+					return entries.size();
+				}
+				group = (group + probe) & mask;
+			}
+		}
+
+		JSONIFIER_INLINE size_type findSlot(key_view_type key, size_type index) const noexcept {
+			const uint64_t hashNew = key_traits::hash(key, seed);
+			const uint8_t control  = static_cast<uint8_t>(hashNew & 0x7F);
+			const uint64_t mask	   = groupMask();
+			uint64_t group		   = (hashNew >> 7) & mask;
+			for (uint64_t probe = 1;; ++probe) {
+				const uint8_t* groupPtr = controls.data() + group * internal::control_bytes::groupSize;
+				uint32_t matches		= internal::control_bytes::match(groupPtr, control);
+				while (matches != 0) {
+					const uint64_t slot = group * internal::control_bytes::groupSize + simd::tzcnt(matches);
+					if (slots[slot] == index) {
+						return slot;
+					}
+					matches &= matches - 1;
+				}
+				group = (group + probe) & mask;
+			}
+		}
+
+		JSONIFIER_INLINE void rehash(size_type slotCount) {
+			controls.assign(slotCount, internal::control_bytes::empty);
+			slots.assign(slotCount, 0);
+			tombstones			= 0;
+			const uint64_t mask = groupMask();
+			for (size_type x = 0; x < entries.size(); ++x) {
+				const uint64_t hashNew = key_traits::hash(entries[x].first, seed);
+				uint64_t group		   = (hashNew >> 7) & mask;
+				for (uint64_t probe = 1;; ++probe) {
+					const uint32_t free = internal::control_bytes::matchEmpty(controls.data() + group * internal::control_bytes::groupSize);
+					if (free != 0) {
+						const uint64_t slot = group * internal::control_bytes::groupSize + simd::tzcnt(free);
+						controls[slot]		= static_cast<uint8_t>(hashNew & 0x7F);
+						slots[slot]			= static_cast<uint32_t>(x);
+						break;
+					}
+					group = (group + probe) & mask;
+				}
+			}
+		}
+	};
+
+}
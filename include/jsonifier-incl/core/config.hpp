@@ -35,6 +35,7 @@
 #include <chrono>
 #include <cfloat>
 #include <atomic>
+#include <thread>
 #include <vector>
 #include <bit>
 
@@ -48,6 +49,7 @@
 	#include <windows.h>
 #elif JSONIFIER_PLATFORM_LINUX || JSONIFIER_PLATFORM_MAC
 	#include <sys/mman.h>
+	#include <sys/uio.h>
 #endif
 
 #if !defined(JSONIFIER_LIKELY)
@@ -66,6 +68,10 @@
 	#define JSONIFIER_ALIGN(b) alignas(b)
 #endif
 
+#if !defined(JSONIFIER_TRACK_ALLOCATIONS)
+	#define JSONIFIER_TRACK_ALLOCATIONS 0
+#endif
+
 namespace jsonifier {
 
 	struct serialize_options {
@@ -73,6 +79,9 @@ namespace jsonifier {
 		char indentChar{ ' ' };
 		uint64_t indent{};
 		bool prettify{};
+		uint64_t chunkSize{ 64 * 1024 };
+		uint64_t parallelThreshold{};
+		uint64_t parallelThreads{};
 	};
 
 	struct parse_options {
@@ -82,6 +91,11 @@ namespace jsonifier {
 		bool validateUtf8{};
 		bool nullTerminated{ true };
 		uint64_t maxDepth{ 1024 };
+		bool reuseStorage{};
+		bool sharedKeyOrder{};
+		bool detectMinified{};
+		bool adaptiveRead{};
+		bool failFast{};
 	};
 
 }
@@ -97,7 +97,17 @@ namespace jsonifier::internal {
 		return returnValues;
 	}
 
-	template<typename value_type> static constexpr auto tupleRefs{ collectTupleRefs(core<value_type>::parseValue) };
+	template<typename value_type> static constexpr decltype(auto) coreEntities() noexcept {
+		if constexpr (requires { core<value_type>::enumValue; }) {
+			return core<value_type>::enumValue;
+		} else if constexpr (requires { core<value_type>::variantTags; }) {
+			return core<value_type>::variantTags;
+		} else {
+			return core<value_type>::parseValue;
+		}
+	}
+
+	template<typename value_type> static constexpr auto tupleRefs{ collectTupleRefs(coreEntities<value_type>()) };
 	template<typename value_type> static constexpr auto tupleReferences{ consolidateTupleRefs(tupleRefs<value_type>) };
 	template<typename value_type> static constexpr auto sortedTupleReferencesByLength{ sortTupleRefsByLength(tupleRefs<value_type>) };
 	template<typename value_type> static constexpr auto tupleReferencesByLength{ consolidateTupleRefs(sortedTupleReferencesByLength<value_type>) };
@@ -35,6 +35,12 @@ namespace jsonifier::internal {
 
 }
 
+namespace jsonifier {
+
+	template<typename derived_type> class value;
+
+}
+
 namespace jsonifier {
 
 	template<uint64_t initialBufferSize = 1024 * 1024> class jsonifier_core : public internal::json_printer,
@@ -50,12 +56,14 @@ namespace jsonifier {
 		friend class internal::validator<jsonifier_core<initialBufferSize>>;
 		friend class internal::minifier<jsonifier_core<initialBufferSize>>;
 		friend class internal::parser<jsonifier_core<initialBufferSize>>;
+		friend class value<jsonifier_core<initialBufferSize>>;
 
 		jsonifier_core() noexcept = default;
 
 		jsonifier_core& operator=(jsonifier_core&& other) noexcept {
 			if JSONIFIER_LIKELY (this != &other) {
-				errors = internal::move(other.errors);
+				errors	   = internal::move(other.errors);
+				stringPool = internal::move(other.stringPool);
 			}
 			return *this;
 		}
@@ -66,7 +74,8 @@ namespace jsonifier {
 
 		jsonifier_core& operator=(const jsonifier_core& other) noexcept {
 			if JSONIFIER_LIKELY (this != &other) {
-				errors = other.errors;
+				errors	   = other.errors;
+				stringPool = other.stringPool;
 			}
 			return *this;
 		}
@@ -79,6 +88,14 @@ namespace jsonifier {
 			return errors;
 		}
 
+		void setStringPool(std::shared_ptr<string_pool> stringPoolNew) noexcept {
+			stringPool = internal::move(stringPoolNew);
+		}
+
+		const std::shared_ptr<string_pool>& getStringPool() const noexcept {
+			return stringPool;
+		}
+
 		~jsonifier_core() noexcept = default;
 
 	  protected:
@@ -92,6 +109,7 @@ namespace jsonifier {
 		internal::simd_string_reader<initialBufferSize> section{};
 		string_base<char, initialBufferSize> stringBuffer{};
 		std::vector<internal::error> errors{};
+		std::shared_ptr<string_pool> stringPool{};
 	};
 
 }
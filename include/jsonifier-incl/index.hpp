@@ -24,8 +24,15 @@
 
 #include <jsonifier-incl/parsing/parse_impl.hpp>
 #include <jsonifier-incl/serializing/serialize_impl.hpp>
+#include <jsonifier-incl/serializing/measure_impl.hpp>
 #include <jsonifier-incl/core/jsonifier_core.hpp>
 #include <jsonifier-incl/utilities/raw_json_data.hpp>
+#include <jsonifier-incl/containers/flat_map.hpp>
+#include <jsonifier-incl/containers/unordered_map.hpp>
+#include <jsonifier-incl/containers/segmented_buffer.hpp>
+#include <jsonifier-incl/parsing/document.hpp>
+#include <jsonifier-incl/parsing/json_pointer.hpp>
+#include <jsonifier-incl/parsing/json_query.hpp>
 #include <jsonifier-incl/serializing/prettifier.hpp>
 #include <jsonifier-incl/serializing/serializer.hpp>
 #include <jsonifier-incl/serializing/minifier.hpp>
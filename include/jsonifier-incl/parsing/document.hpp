@@ -0,0 +1,303 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+#pragma once
+
+#include <jsonifier-incl/parsing/parse_impl.hpp>
+#include <jsonifier-incl/utilities/raw_json_data.hpp>
+
+namespace jsonifier::internal {
+
+	struct document_tape {
+		JSONIFIER_INLINE static structural_index_ptr skip(string_view_ptr stringRoot, structural_index_ptr iter, structural_index_ptr endIter) noexcept {
+			const char first = stringRoot[*iter];
+			++iter;
+			if (first != '{' && first != '[') {
+				return iter;
+			}
+			uint64_t depth{ 1 };
+			while (iter < endIter) {
+				const char c = stringRoot[*iter];
+				++iter;
+				if (c == '{' || c == '[') {
+					++depth;
+				} else if ((c == '}' || c == ']') && --depth == 0) {
+					return iter;
+				}
+			}
+			return endIter;
+		}
+
+		JSONIFIER_INLINE static string_view key(string_view_ptr stringRoot, structural_index_ptr keyIter) noexcept {
+			string_view_ptr start = stringRoot + keyIter[0] + 1;
+			string_view_ptr end	  = stringRoot + keyIter[1];
+			while (end > start && end[-1] != '"') {
+				--end;
+			}
+			return end > start ? string_view{ start, static_cast<uint64_t>(end - 1 - start) } : string_view{};
+		}
+
+		JSONIFIER_INLINE static string_view raw(string_view_ptr stringRoot, structural_index_ptr iter, structural_index_ptr endIter) noexcept {
+			const auto next		  = skip(stringRoot, iter, endIter);
+			string_view_ptr start = stringRoot + *iter;
+			string_view_ptr end{};
+			if (*start == '{' || *start == '[') {
+				end = stringRoot + next[-1] + 1;
+			} else {
+				end = stringRoot + *next;
+				while (end > start && whitespaceTable[static_cast<uint8_t>(end[-1])]) {
+					--end;
+				}
+			}
+			return string_view{ start, static_cast<uint64_t>(end - start) };
+		}
+
+		JSONIFIER_INLINE static bool keysMatch(string_view key, string_view keyNew) noexcept {
+			return key == keyNew || (std::memchr(key.data(), '\\', key.size()) != nullptr && unescapeRawJsonString(key.data(), key.size()) == keyNew);
+		}
+	};
+
+}
+
+namespace jsonifier {
+
+	template<typename derived_type> class value {
+	  public:
+		class iterator {
+		  public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type		= value;
+			using difference_type	= std::ptrdiff_t;
+			using reference			= value;
+
+			inline iterator() noexcept = default;
+
+			inline iterator(const value& parent) noexcept : current{ parent } {
+				current.keyIter = nullptr;
+				current.iter	= nullptr;
+				if (parent.valid()) {
+					const char first = parent.stringRoot[*parent.iter];
+					if (first == '{' || first == '[') {
+						object = first == '{';
+						seek(parent.iter + 1);
+					}
+				}
+			}
+
+			inline value operator*() const noexcept {
+				return current;
+			}
+
+			inline const value* operator->() const noexcept {
+				return &current;
+			}
+
+			inline iterator& operator++() noexcept {
+				const auto next = internal::document_tape::skip(current.stringRoot, current.iter, current.endIter);
+				if (next < current.endIter && current.stringRoot[*next] == ',') {
+					seek(next + 1);
+				} else {
+					current.keyIter = nullptr;
+					current.iter	= nullptr;
+				}
+				return *this;
+			}
+
+			inline iterator operator++(int) noexcept {
+				iterator temp{ *this };
+				++*this;
+				return temp;
+			}
+
+			inline bool operator==(const iterator& other) const noexcept {
+				return current.iter == other.current.iter;
+			}
+
+		  protected:
+			value current{};
+			bool object{};
+
+			inline void seek(structural_index_ptr start) noexcept {
+				current.keyIter = nullptr;
+				current.iter	= nullptr;
+				if (start >= current.endIter) {
+					return;
+				}
+				const char c = current.stringRoot[*start];
+				if (c == ']' || c == '}') {
+					return;
+				}
+				if (object) {
+					if (c == '"' && start + 2 < current.endIter && current.stringRoot[start[1]] == ':') {
+						current.keyIter = start;
+						current.iter	= start + 2;
+					}
+				} else {
+					current.iter = start;
+				}
+			}
+		};
+
+		inline value() noexcept = default;
+
+		inline value(derived_type* coreNew, structural_index_ptr rootIterNew, structural_index_ptr endIterNew, structural_index_ptr iterNew, string_view_ptr stringRootNew,
+			string_view_ptr stringEndNew) noexcept
+			: core{ coreNew }, rootIter{ rootIterNew }, endIter{ endIterNew }, iter{ iterNew }, stringRoot{ stringRootNew }, stringEnd{ stringEndNew } {
+		}
+
+		inline bool valid() const noexcept {
+			return iter && iter < endIter;
+		}
+
+		inline explicit operator bool() const noexcept {
+			return valid();
+		}
+
+		inline json_type type() const noexcept {
+			if JSONIFIER_UNLIKELY (!valid()) {
+				return json_type::unset;
+			}
+			switch (stringRoot[*iter]) {
+				case '{': {
+					return json_type::object;
+				}
+				case '[': {
+					return json_type::array;
+				}
+				case '"': {
+					return json_type::string;
+				}
+				case 't':
+					[[fallthrough]];
+				case 'f': {
+					return json_type::boolean;
+				}
+				case 'n': {
+					return json_type::null;
+				}
+				default: {
+					return json_type::number;
+				}
+			}
+		}
+
+		inline string_view key() const noexcept {
+			return keyIter ? internal::document_tape::key(stringRoot, keyIter) : string_view{};
+		}
+
+		inline string_view rawJson() const noexcept {
+			return valid() ? internal::document_tape::raw(stringRoot, iter, endIter) : string_view{};
+		}
+
+		inline iterator begin() const noexcept {
+			return iterator{ *this };
+		}
+
+		inline iterator end() const noexcept {
+			return iterator{};
+		}
+
+		template<std::convertible_to<string_view> key_type> inline value operator[](key_type&& keyNew) const noexcept {
+			const string_view key{ keyNew };
+			if (type() == json_type::object) {
+				for (auto iterNew = begin(); iterNew != end(); ++iterNew) {
+					if (internal::document_tape::keysMatch(iterNew->key(), key)) {
+						return *iterNew;
+					}
+				}
+			}
+			return value{};
+		}
+
+		template<std::integral index_type> inline value operator[](index_type index) const noexcept {
+			if (type() == json_type::array) {
+				for (auto iterNew = begin(); iterNew != end(); ++iterNew, --index) {
+					if (index == 0) {
+						return *iterNew;
+					}
+				}
+			}
+			return value{};
+		}
+
+		template<std::convertible_to<string_view> key_type> inline bool contains(key_type&& key) const noexcept {
+			return operator[](std::forward<key_type>(key)).valid();
+		}
+
+		inline uint64_t size() const noexcept {
+			uint64_t count{};
+			for (auto iterNew = begin(); iterNew != end(); ++iterNew) {
+				++count;
+			}
+			return count;
+		}
+
+		template<parse_options options = parse_options{}, typename value_type> inline bool get(value_type&& object) const noexcept {
+			static constexpr parse_options getOpts{ [] {
+				parse_options returnValues{ options };
+				returnValues.partialRead = true;
+				return returnValues;
+			}() };
+			if JSONIFIER_UNLIKELY (!valid()) {
+				return false;
+			}
+			auto& errors		  = core->errors;
+			const auto errorCount = errors.size();
+			const internal::string_pool_scope poolScope{ core->stringPool.get() };
+			internal::json_iterator<getOpts, structural_index_ptr, string_buffer_type> context{ &core->stringBuffer, &errors, rootIter, endIter, iter, stringRoot, stringEnd };
+			internal::parse<getOpts>::impl(object, context);
+			return errors.size() == errorCount;
+		}
+
+		template<typename value_type, parse_options options = parse_options{}> inline value_type get() const noexcept {
+			value_type returnValue{};
+			get<options>(returnValue);
+			return returnValue;
+		}
+
+	  protected:
+		using string_buffer_type = decltype(derived_type::stringBuffer);
+
+		derived_type* core{};
+		structural_index_ptr rootIter{};
+		structural_index_ptr endIter{};
+		structural_index_ptr iter{};
+		structural_index_ptr keyIter{};
+		string_view_ptr stringRoot{};
+		string_view_ptr stringEnd{};
+	};
+
+	template<typename derived_type> class document : public value<derived_type> {
+	  public:
+		inline document() noexcept = default;
+
+		inline document(derived_type* coreNew, structural_index_ptr rootIterNew, structural_index_ptr endIterNew, string_view_ptr stringRootNew,
+			string_view_ptr stringEndNew) noexcept
+			: value<derived_type>{ coreNew, rootIterNew, endIterNew, rootIterNew, stringRootNew, stringEndNew } {
+		}
+
+		inline uint64_t structuralCount() const noexcept {
+			return static_cast<uint64_t>(this->endIter - this->rootIter);
+		}
+	};
+
+}
@@ -0,0 +1,228 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+#pragma once
+
+#include <jsonifier-incl/parsing/parse_impl.hpp>
+
+namespace jsonifier::internal {
+
+	template<string_literal path> struct json_pointer {
+		static_assert(path.size() == 0 || path[0] == '/', "A JSON Pointer must be empty or begin with '/'.");
+
+		static constexpr uint64_t segmentCount{ [] {
+			uint64_t count{};
+			for (uint64_t x = 0; x < path.size(); ++x) {
+				count += path[x] == '/';
+			}
+			return count;
+		}() };
+
+		template<uint64_t index> static constexpr uint64_t segmentStart{ [] {
+			uint64_t count{};
+			for (uint64_t x = 0; x < path.size(); ++x) {
+				if (path[x] == '/' && count++ == index) {
+					return x + 1;
+				}
+			}
+			return path.size();
+		}() };
+
+		template<uint64_t index> static constexpr uint64_t segmentEnd{ [] {
+			uint64_t x = segmentStart<index>;
+			while (x < path.size() && path[x] != '/') {
+				++x;
+			}
+			return x;
+		}() };
+
+		template<uint64_t index> static constexpr uint64_t segmentLength{ [] {
+			uint64_t length{};
+			for (uint64_t x = segmentStart<index>; x < segmentEnd<index>; ++x) {
+				x += path[x] == '~';
+				++length;
+			}
+			return length;
+		}() };
+
+		template<uint64_t index> static constexpr string_literal<segmentLength<index> + 1> segment{ [] {
+			string_literal<segmentLength<index> + 1> returnValues{};
+			uint64_t outIndex{};
+			for (uint64_t x = segmentStart<index>; x < segmentEnd<index>; ++x) {
+				if (path[x] == '~') {
+					++x;
+					returnValues[outIndex] = path[x] == '1' ? '/' : '~';
+				} else {
+					returnValues[outIndex] = path[x];
+				}
+				++outIndex;
+			}
+			return returnValues;
+		}() };
+
+		template<uint64_t index> static constexpr bool isIndex{ [] {
+			constexpr auto& segmentNew = segment<index>;
+			if (segmentNew.size() == 0 || (segmentNew.size() > 1 && segmentNew[0] == '0')) {
+				return false;
+			}
+			for (uint64_t x = 0; x < segmentNew.size(); ++x) {
+				if (segmentNew[x] < '0' || segmentNew[x] > '9') {
+					return false;
+				}
+			}
+			return true;
+		}() };
+
+		template<uint64_t index> static constexpr uint64_t arrayIndex{ [] {
+			constexpr auto& segmentNew = segment<index>;
+			uint64_t returnValue{};
+			if constexpr (isIndex<index>) {
+				for (uint64_t x = 0; x < segmentNew.size(); ++x) {
+					returnValue = returnValue * 10 + static_cast<uint64_t>(segmentNew[x] - '0');
+				}
+			}
+			return returnValue;
+		}() };
+	};
+
+	template<string_literal path, parse_options options> struct json_pointer_extract {
+		using pointer_type = json_pointer<path>;
+
+		template<uint64_t index, typename context_type> JSONIFIER_INLINE static parse_result matchKey(context_type& context) noexcept {
+			static constexpr auto keyLiteral	= escapedKeyLiteral<pointer_type::template segment<index>>;
+			static constexpr auto fusedKey		= makeFusedKeyLiteral(keyLiteral);
+			static constexpr auto fusedKeySize	= fusedKey.size();
+			static constexpr auto quotedKey		= makeQuotedKeyLiteral(keyLiteral);
+			static constexpr auto quotedKeySize = quotedKey.size();
+			const auto keyStart					= context.currentPtr();
+			if JSONIFIER_LIKELY (((keyStart + fusedKeySize) < context.endPtr()) && string_literal_comparitor<decltype(fusedKey), fusedKey>::impl(keyStart)) {
+				context.currentPtr() += fusedKeySize;
+				return parse_result::active_member;
+			}
+			if constexpr (!options.minified) {
+				if JSONIFIER_UNLIKELY (((keyStart + quotedKeySize) < context.endPtr()) && string_literal_comparitor<decltype(quotedKey), quotedKey>::impl(keyStart)) {
+					context.currentPtr() += quotedKeySize;
+					return context.collectObjectColon() ? parse_result::active_member : parse_result::failed;
+				}
+			}
+			return parse_result::inactive_member;
+		}
+
+		template<uint64_t index, typename value_type, typename context_type> JSONIFIER_INLINE static bool findMember(value_type& value, context_type& context) noexcept {
+			if (context.objectMaybeEnd()) {
+				return false;
+			}
+			if constexpr (!options.minified) {
+				context.skipWhitespace();
+			}
+			while (true) {
+				if JSONIFIER_UNLIKELY (!context.template checkChar<'"'>()) {
+					return context.template reject<parse_statuses::missing_key_start>();
+				}
+				switch (matchKey<index>(context)) {
+					case parse_result::active_member: {
+						return impl<index + 1>(value, context);
+					}
+					case parse_result::failed: {
+						return false;
+					}
+					default: {
+						break;
+					}
+				}
+				if JSONIFIER_UNLIKELY (!context.skipString() || !context.collectObjectColon() || !context.skipValue()) {
+					return false;
+				}
+				if (context.collectObjectSeparator() != sep_result::cont) {
+					return false;
+				}
+			}
+		}
+
+		template<uint64_t index, typename value_type, typename context_type> JSONIFIER_INLINE static bool findElement(value_type& value, context_type& context) noexcept {
+			if (context.arrayMaybeEnd()) {
+				return false;
+			}
+			for (uint64_t x = 0; x < pointer_type::template arrayIndex<index>; ++x) {
+				if JSONIFIER_UNLIKELY (!context.skipValue()) {
+					return false;
+				}
+				if (context.collectArraySeparator() != sep_result::cont) {
+					return false;
+				}
+			}
+			return impl<index + 1>(value, context);
+		}
+
+		template<uint64_t index, typename value_type, typename context_type> JSONIFIER_INLINE static bool impl(value_type& value, context_type& context) noexcept {
+			if constexpr (index == pointer_type::segmentCount) {
+				return parse<options>::impl(value, context);
+			} else {
+				if constexpr (!options.minified) {
+					context.skipWhitespace();
+				}
+				if JSONIFIER_UNLIKELY (!context.notAtEndPre()) {
+					return context.template reject<parse_statuses::unexpected_end_of_input>();
+				}
+				switch (*context.currentPtr()) {
+					case '{': {
+						return context.objectStart() && findMember<index>(value, context);
+					}
+					case '[': {
+						if constexpr (pointer_type::template isIndex<index>) {
+							return context.arrayStart() && findElement<index>(value, context);
+						} else {
+							return false;
+						}
+					}
+					default: {
+						return false;
+					}
+				}
+			}
+		}
+
+		template<typename value_type, typename string_buffer_type>
+		JSONIFIER_INLINE static bool rootImpl(value_type& value, string_view_ptr iter, string_view_ptr endIter, string_buffer_type& stringBuffer, std::vector<error>& errors) noexcept {
+			json_iterator<options, string_view_ptr, string_buffer_type> context{ &stringBuffer, &errors, iter, endIter };
+			auto newSize = static_cast<uint64_t>(endIter - iter);
+			if (stringBuffer.size() < newSize) {
+				stringBuffer.resize(newSize);
+			}
+			errors.clear();
+			return context.anyInput() && impl<0>(value, context) && errors.size() == 0;
+		}
+	};
+
+}
+
+namespace jsonifier {
+
+	template<internal::string_literal path, parse_options options = parse_options{}, typename buffer_type, typename value_type>
+	inline bool extract(buffer_type&& in, value_type&& value) noexcept {
+		static thread_local string_base<char, 1024 * 16> stringBuffer{};
+		static thread_local std::vector<internal::error> errors{};
+		return internal::json_pointer_extract<path, internal::extractOptions<options>>::rootImpl(value, internal::getBeginIter(in), internal::getEndIter(in), stringBuffer,
+			errors);
+	}
+
+}
@@ -0,0 +1,561 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+#pragma once
+
+#include <jsonifier-incl/parsing/document.hpp>
+#include <jsonifier-incl/utilities/hash.hpp>
+#include <functional>
+
+namespace jsonifier::internal {
+
+	enum class query_segment_types : uint8_t {
+		key			 = 0,
+		index		 = 1,
+		index_or_key = 2,
+		wildcard	 = 3,
+	};
+
+	struct query_segment {
+		query_segment_types type{};
+		uint64_t index{};
+		std::string key{};
+	};
+
+	struct query_expression_parser {
+		static bool parseIndex(string_view digits, uint64_t& index) noexcept {
+			if (digits.size() == 0 || digits.size() > 19 || (digits.size() > 1 && digits[0] == '0')) {
+				return false;
+			}
+			index = 0;
+			for (const char c: digits) {
+				if (c < '0' || c > '9') {
+					return false;
+				}
+				index = index * 10 + static_cast<uint64_t>(c - '0');
+			}
+			return true;
+		}
+
+		static bool parsePointer(string_view expression, std::vector<query_segment>& segments) noexcept {
+			uint64_t x = 0;
+			while (x < expression.size()) {
+				++x;
+				query_segment segment{};
+				while (x < expression.size() && expression[x] != '/') {
+					if (expression[x] == '~') {
+						if (x + 1 >= expression.size() || (expression[x + 1] != '0' && expression[x + 1] != '1')) {
+							return false;
+						}
+						segment.key.push_back(expression[x + 1] == '1' ? '/' : '~');
+						x += 2;
+					} else {
+						segment.key.push_back(expression[x]);
+						++x;
+					}
+				}
+				if (segment.key == "*") {
+					segment.type = query_segment_types::wildcard;
+				} else if (parseIndex(segment.key, segment.index)) {
+					segment.type = query_segment_types::index_or_key;
+				}
+				segments.emplace_back(internal::move(segment));
+			}
+			return true;
+		}
+
+		static bool parsePath(string_view expression, std::vector<query_segment>& segments) noexcept {
+			uint64_t x = 1;
+			while (x < expression.size()) {
+				query_segment segment{};
+				if (expression[x] == '.') {
+					++x;
+					if (x < expression.size() && expression[x] == '*') {
+						segment.type = query_segment_types::wildcard;
+						++x;
+					} else {
+						while (x < expression.size() && expression[x] != '.' && expression[x] != '[') {
+							segment.key.push_back(expression[x]);
+							++x;
+						}
+						if (segment.key.size() == 0) {
+							return false;
+						}
+					}
+				} else if (expression[x] == '[') {
+					++x;
+					if (x < expression.size() && (expression[x] == '\'' || expression[x] == '"')) {
+						const char quote = expression[x];
+						++x;
+						while (x < expression.size() && expression[x] != quote) {
+							if (expression[x] == '\\' && x + 1 < expression.size()) {
+								++x;
+							}
+							segment.key.push_back(expression[x]);
+							++x;
+						}
+						if (x >= expression.size()) {
+							return false;
+						}
+						++x;
+					} else if (x < expression.size() && expression[x] == '*') {
+						segment.type = query_segment_types::wildcard;
+						++x;
+					} else {
+						const uint64_t start = x;
+						while (x < expression.size() && expression[x] != ']') {
+							++x;
+						}
+						if (!parseIndex(expression.substr(start, x - start), segment.index)) {
+							return false;
+						}
+						segment.type = query_segment_types::index;
+					}
+					if (x >= expression.size() || expression[x] != ']') {
+						return false;
+					}
+					++x;
+				} else {
+					return false;
+				}
+				segments.emplace_back(internal::move(segment));
+			}
+			return true;
+		}
+
+		static bool impl(string_view expression, std::vector<query_segment>& segments) noexcept {
+			if (expression.size() == 0 || expression[0] == '/') {
+				return parsePointer(expression, segments);
+			} else if (expression[0] == '$') {
+				return parsePath(expression, segments);
+			}
+			return false;
+		}
+
+		static std::string escapeKey(string_view key) noexcept {
+			std::string returnValue{};
+			for (const char c: key) {
+				if (c == '"' || c == '\\') {
+					returnValue.push_back('\\');
+				}
+				returnValue.push_back(c);
+			}
+			return returnValue;
+		}
+	};
+
+	struct query_context {
+		string_base<char, 1024 * 16>* stringBuffer{};
+		std::vector<error>* errors{};
+		structural_index_ptr rootIter{};
+		structural_index_ptr endIter{};
+		string_view_ptr stringRoot{};
+		string_view_ptr stringEnd{};
+	};
+
+	struct query_output {
+		void* target{};
+		bool (*deliver)(void*, query_context&, structural_index_ptr){};
+		void (*reset)(void*){};
+		std::function<void(string_view)> callback{};
+	};
+
+	template<typename value_type, parse_options options, bool append> struct query_output_parser {
+		static constexpr parse_options queryOpts{ [] {
+			parse_options returnValues{ options };
+			returnValues.partialRead = true;
+			return returnValues;
+		}() };
+
+		static bool deliver(void* target, query_context& context, structural_index_ptr iter) noexcept {
+			json_iterator<queryOpts, structural_index_ptr, string_base<char, 1024 * 16>> iterContext{ context.stringBuffer, context.errors, context.rootIter, context.endIter,
+				iter, context.stringRoot, context.stringEnd };
+			auto& value = *static_cast<value_type*>(target);
+			if constexpr (append) {
+				return parse<queryOpts>::impl(value.emplace_back(), iterContext);
+			} else {
+				return parse<queryOpts>::impl(value, iterContext);
+			}
+		}
+
+		static void reset(void* target) noexcept {
+			if constexpr (append) {
+				static_cast<value_type*>(target)->clear();
+			}
+		}
+	};
+
+	struct query_key_slot {
+		std::string key{};
+		uint32_t child{ std::numeric_limits<uint32_t>::max() };
+	};
+
+	struct query_node {
+		static constexpr uint32_t npos{ std::numeric_limits<uint32_t>::max() };
+		std::vector<std::pair<std::string, uint32_t>> keys{};
+		std::vector<std::pair<uint64_t, uint32_t>> indices{};
+		std::vector<uint32_t> outputs{};
+		uint32_t wildcard{ npos };
+		uint32_t keyTable{};
+		uint32_t keyMask{};
+
+		bool hasChildren() const noexcept {
+			return keys.size() > 0 || indices.size() > 0 || wildcard != npos;
+		}
+	};
+
+}
+
+namespace jsonifier {
+
+	class json_query {
+	  public:
+		using callback_type = std::function<void(string_view)>;
+
+		inline json_query() noexcept {
+			nodes.emplace_back();
+		}
+
+		template<parse_options options = parse_options{}, typename value_type>
+			requires(!std::is_invocable_v<value_type, string_view>)
+		inline bool add(string_view expression, value_type& output) noexcept {
+			uint32_t node{};
+			bool wildcard{};
+			if (!insert(expression, node, wildcard)) {
+				return false;
+			}
+			internal::query_output outputNew{};
+			outputNew.target = &output;
+			if constexpr (concepts::vector_t<value_type>) {
+				if (wildcard) {
+					outputNew.deliver = &internal::query_output_parser<value_type, options, true>::deliver;
+					outputNew.reset	  = &internal::query_output_parser<value_type, options, true>::reset;
+				} else {
+					outputNew.deliver = &internal::query_output_parser<value_type, options, false>::deliver;
+				}
+			} else {
+				outputNew.deliver = &internal::query_output_parser<value_type, options, false>::deliver;
+			}
+			return addOutput(node, internal::move(outputNew));
+		}
+
+		inline bool add(string_view expression, callback_type callback) noexcept {
+			uint32_t node{};
+			bool wildcard{};
+			if (!insert(expression, node, wildcard)) {
+				return false;
+			}
+			internal::query_output outputNew{};
+			outputNew.callback = internal::move(callback);
+			return addOutput(node, internal::move(outputNew));
+		}
+
+		inline uint64_t size() const noexcept {
+			return outputs.size();
+		}
+
+		inline bool run(structural_index_ptr rootIterNew, structural_index_ptr endIterNew, string_view_ptr stringRootNew, string_view_ptr stringEndNew,
+			std::vector<internal::error>& errorsNew, uint64_t maxDepthNew) noexcept {
+			if (dirty) {
+				compile();
+			}
+			auto newSize = static_cast<uint64_t>(stringEndNew - stringRootNew);
+			if (stringBuffer.size() < newSize) {
+				stringBuffer.resize(newSize);
+			}
+			context  = internal::query_context{ &stringBuffer, &errorsNew, rootIterNew, endIterNew, stringRootNew, stringEndNew };
+			maxDepth = maxDepthNew;
+			for (auto& output: outputs) {
+				if (output.reset) {
+					output.reset(output.target);
+				}
+			}
+			if JSONIFIER_UNLIKELY (rootIterNew >= endIterNew) {
+				return false;
+			}
+			const auto errorCount = errorsNew.size();
+			active.clear();
+			active.emplace_back(0);
+			deliver(0, rootIterNew);
+			if (nodes[0].hasChildren()) {
+				static_cast<void>(walk(rootIterNew, 0, 1, 0));
+			}
+			return errorsNew.size() == errorCount;
+		}
+
+	  protected:
+		static constexpr uint32_t npos{ internal::query_node::npos };
+
+		std::vector<internal::query_node> nodes{};
+		std::vector<internal::query_key_slot> keySlots{};
+		std::vector<internal::query_output> outputs{};
+		std::vector<uint32_t> active{};
+		string_base<char, 1024 * 16> stringBuffer{};
+		internal::query_context context{};
+		internal::rt_seeded_key_hasher hasher{};
+		uint64_t maxDepth{};
+		bool dirty{};
+
+		inline uint32_t child(uint32_t existing) noexcept {
+			if (existing != npos) {
+				return existing;
+			}
+			nodes.emplace_back();
+			return static_cast<uint32_t>(nodes.size() - 1);
+		}
+
+		inline uint32_t keyChild(uint32_t node, const std::string& key, uint32_t preferred) noexcept {
+			for (auto& [keyNew, childNew]: nodes[node].keys) {
+				if (keyNew == key) {
+					return childNew;
+				}
+			}
+			const uint32_t childNew = child(preferred);
+			nodes[node].keys.emplace_back(key, childNew);
+			return childNew;
+		}
+
+		inline uint32_t indexChild(uint32_t node, uint64_t index, uint32_t preferred) noexcept {
+			for (auto& [indexNew, childNew]: nodes[node].indices) {
+				if (indexNew == index) {
+					return childNew;
+				}
+			}
+			const uint32_t childNew = child(preferred);
+			nodes[node].indices.emplace_back(index, childNew);
+			return childNew;
+		}
+
+		inline bool insert(string_view expression, uint32_t& node, bool& wildcard) noexcept {
+			std::vector<internal::query_segment> segments{};
+			if (!internal::query_expression_parser::impl(expression, segments)) {
+				return false;
+			}
+			node = 0;
+			for (auto& segment: segments) {
+				switch (segment.type) {
+					case internal::query_segment_types::key: {
+						node = keyChild(node, internal::query_expression_parser::escapeKey(segment.key), npos);
+						break;
+					}
+					case internal::query_segment_types::index: {
+						node = indexChild(node, segment.index, npos);
+						break;
+					}
+					case internal::query_segment_types::index_or_key: {
+						const uint32_t childNew = indexChild(node, segment.index, npos);
+						node					= keyChild(node, segment.key, childNew);
+						break;
+					}
+					case internal::query_segment_types::wildcard: {
+						const uint32_t childNew = child(nodes[node].wildcard);
+						nodes[node].wildcard	= childNew;
+						node					= childNew;
+						wildcard				= true;
+						break;
+					}
+				}
+			}
+			dirty = true;
+			return true;
+		}
+
+		inline bool addOutput(uint32_t node, internal::query_output&& output) noexcept {
+			nodes[node].outputs.emplace_back(static_cast<uint32_t>(outputs.size()));
+			outputs.emplace_back(internal::move(output));
+			return true;
+		}
+
+		inline bool buildKeyTables() noexcept {
+			keySlots.clear();
+			for (auto& node: nodes) {
+				node.keyTable = static_cast<uint32_t>(keySlots.size());
+				node.keyMask  = 0;
+				if (node.keys.size() == 0) {
+					continue;
+				}
+				uint64_t capacity = std::bit_ceil(node.keys.size() * 2);
+				while (true) {
+					if (capacity > (node.keys.size() * 64)) {
+						return false;
+					}
+					keySlots.resize(node.keyTable + capacity);
+					bool collided{};
+					for (auto& [key, childNew]: node.keys) {
+						auto& slot = keySlots[node.keyTable + (hasher.hashKeyRt(key.data(), key.size()) & (capacity - 1))];
+						if (slot.child != npos) {
+							collided = true;
+							break;
+						}
+						slot.key   = key;
+						slot.child = childNew;
+					}
+					if (!collided) {
+						node.keyMask = static_cast<uint32_t>(capacity - 1);
+						break;
+					}
+					for (uint64_t x = node.keyTable; x < keySlots.size(); ++x) {
+						keySlots[x] = internal::query_key_slot{};
+					}
+					capacity *= 2;
+				}
+			}
+			return true;
+		}
+
+		inline void compile() noexcept {
+			for (uint64_t x = 0; x < internal::prns.size(); ++x) {
+				hasher.seed = internal::prns[x];
+				if (buildKeyTables()) {
+					break;
+				}
+			}
+			dirty = false;
+		}
+
+		JSONIFIER_INLINE uint32_t lookupKey(const internal::query_node& node, string_view key, uint64_t hash) const noexcept {
+			const auto& slot = keySlots[node.keyTable + (hash & node.keyMask)];
+			return (slot.child != npos && slot.key.size() == key.size() && std::memcmp(slot.key.data(), key.data(), key.size()) == 0) ? slot.child : npos;
+		}
+
+		JSONIFIER_INLINE void deliver(uint32_t node, structural_index_ptr iter) noexcept {
+			for (const uint32_t index: nodes[node].outputs) {
+				auto& output = outputs[index];
+				if (output.deliver) {
+					static_cast<void>(output.deliver(output.target, context, iter));
+				} else {
+					output.callback(internal::document_tape::raw(context.stringRoot, iter, context.endIter));
+				}
+			}
+		}
+
+		inline structural_index_ptr descend(structural_index_ptr iter, uint64_t activeBegin, uint64_t activeEnd, uint64_t depth) noexcept {
+			bool hasChildren{};
+			for (uint64_t x = activeBegin; x < activeEnd; ++x) {
+				deliver(active[x], iter);
+				hasChildren |= nodes[active[x]].hasChildren();
+			}
+			return hasChildren ? walk(iter, activeBegin, activeEnd, depth + 1) : internal::document_tape::skip(context.stringRoot, iter, context.endIter);
+		}
+
+		template<internal::parse_statuses status> inline structural_index_ptr reject(structural_index_ptr iter) noexcept {
+			const string_view_ptr position = iter < context.endIter ? context.stringRoot + *iter : context.stringEnd;
+			context.errors->emplace_back(internal::error::constructError<internal::status_classes::parsing, status>(context.stringRoot, position, context.stringEnd));
+			return nullptr;
+		}
+
+		inline structural_index_ptr walk(structural_index_ptr iter, uint64_t activeBegin, uint64_t activeEnd, uint64_t depth) noexcept {
+			if JSONIFIER_UNLIKELY (depth >= maxDepth) {
+				return reject<internal::parse_statuses::exceeded_max_depth>(iter);
+			}
+			const auto stringRoot = context.stringRoot;
+			const auto endIter	  = context.endIter;
+			const char first	  = stringRoot[*iter];
+			if (first == '{') {
+				++iter;
+				if (iter < endIter && stringRoot[*iter] == '}') {
+					return iter + 1;
+				}
+				bool anyKeys{};
+				for (uint64_t x = activeBegin; x < activeEnd; ++x) {
+					anyKeys |= nodes[active[x]].keys.size() > 0;
+				}
+				while (true) {
+					if JSONIFIER_UNLIKELY (iter + 2 >= endIter || stringRoot[*iter] != '"' || stringRoot[iter[1]] != ':') {
+						return reject<internal::parse_statuses::missing_key_start>(iter);
+					}
+					const uint64_t childBegin = active.size();
+					if (anyKeys) {
+						const auto key	= internal::document_tape::key(stringRoot, iter);
+						const auto hash = hasher.hashKeyRt(key.data(), key.size());
+						for (uint64_t x = activeBegin; x < activeEnd; ++x) {
+							const auto& node = nodes[active[x]];
+							if (node.keys.size() > 0) {
+								if (const uint32_t childNew = lookupKey(node, key, hash); childNew != npos) {
+									active.emplace_back(childNew);
+								}
+							}
+						}
+					}
+					for (uint64_t x = activeBegin; x < activeEnd; ++x) {
+						if (const uint32_t childNew = nodes[active[x]].wildcard; childNew != npos) {
+							active.emplace_back(childNew);
+						}
+					}
+					const uint64_t childEnd = active.size();
+					iter					= childEnd > childBegin ? descend(iter + 2, childBegin, childEnd, depth) : internal::document_tape::skip(stringRoot, iter + 2, endIter);
+					active.resize(childBegin);
+					if JSONIFIER_UNLIKELY (!iter || iter >= endIter) {
+						return iter ? reject<internal::parse_statuses::missing_object_end>(iter) : nullptr;
+					}
+					const char c = stringRoot[*iter];
+					if (c == ',') {
+						++iter;
+					} else if (c == '}') {
+						return iter + 1;
+					} else {
+						return reject<internal::parse_statuses::missing_comma>(iter);
+					}
+				}
+			} else if (first == '[') {
+				++iter;
+				if (iter < endIter && stringRoot[*iter] == ']') {
+					return iter + 1;
+				}
+				for (uint64_t index = 0;; ++index) {
+					if JSONIFIER_UNLIKELY (iter >= endIter) {
+						return reject<internal::parse_statuses::missing_array_end>(iter);
+					}
+					const uint64_t childBegin = active.size();
+					for (uint64_t x = activeBegin; x < activeEnd; ++x) {
+						const auto& node = nodes[active[x]];
+						for (auto& [indexNew, childNew]: node.indices) {
+							if (indexNew == index) {
+								active.emplace_back(childNew);
+							}
+						}
+						if (node.wildcard != npos) {
+							active.emplace_back(node.wildcard);
+						}
+					}
+					const uint64_t childEnd = active.size();
+					iter					= childEnd > childBegin ? descend(iter, childBegin, childEnd, depth) : internal::document_tape::skip(stringRoot, iter, endIter);
+					active.resize(childBegin);
+					if JSONIFIER_UNLIKELY (!iter || iter >= endIter) {
+						return iter ? reject<internal::parse_statuses::missing_array_end>(iter) : nullptr;
+					}
+					const char c = stringRoot[*iter];
+					if (c == ',') {
+						++iter;
+					} else if (c == ']') {
+						return iter + 1;
+					} else {
+						return reject<internal::parse_statuses::missing_comma>(iter);
+					}
+				}
+			} else {
+				return iter + 1;
+			}
+		}
+	};
+
+}
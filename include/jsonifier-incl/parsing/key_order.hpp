@@ -0,0 +1,125 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+#pragma once
+
+#include <jsonifier-incl/utilities/json_entity.hpp>
+#include <jsonifier-incl/utilities/string.hpp>
+#include <jsonifier-incl/core/core.hpp>
+
+namespace jsonifier {
+
+	struct key_order_profile {
+		std::vector<string> keys{};
+	};
+
+	template<> struct core<key_order_profile> {
+		using value_type				 = key_order_profile;
+		static constexpr auto parseValue = createValue<&value_type::keys>();
+	};
+
+}
+
+namespace jsonifier::internal {
+
+	template<uint64_t memberCount> constexpr array<uint64_t, (memberCount > 0 ? memberCount : 1)> generateAntiHashStatesTableNew() {
+		array<uint64_t, (memberCount > 0 ? memberCount : 1)> returnValues{};
+		for (uint64_t x = 0; x < memberCount; ++x) {
+			returnValues[x] = x;
+		}
+		return returnValues;
+	}
+
+	template<uint64_t... indices> constexpr array<std::atomic<uint64_t>, sizeof...(indices)> generateSharedAntiHashStatesTableNew(integer_sequence<indices...>) {
+		return { { std::atomic<uint64_t>{ indices }... } };
+	}
+
+	template<uint64_t memberCount, typename value_type>
+	thread_local constinit static array<uint64_t, (memberCount > 0 ? memberCount : 1)> antiHashStatesNew{ generateAntiHashStatesTableNew<memberCount>() };
+
+	template<uint64_t memberCount, typename value_type> inline constinit array<std::atomic<uint64_t>, (memberCount > 0 ? memberCount : 1)> sharedAntiHashStatesNew{
+		generateSharedAntiHashStatesTableNew(make_integer_sequence<(memberCount > 0 ? memberCount : 1)>{})
+	};
+
+	template<parse_options options, uint64_t memberCount, typename value_type> struct anti_hash_states {
+		JSONIFIER_INLINE static uint64_t load(uint64_t index) noexcept {
+			if constexpr (options.sharedKeyOrder) {
+				return sharedAntiHashStatesNew<memberCount, value_type>[index].load(std::memory_order_relaxed);
+			} else {
+				return antiHashStatesNew<memberCount, value_type>[index];
+			}
+		}
+
+		JSONIFIER_INLINE static void store(uint64_t index, uint64_t value) noexcept {
+			if constexpr (options.sharedKeyOrder) {
+				auto& state = sharedAntiHashStatesNew<memberCount, value_type>[index];
+				if (state.load(std::memory_order_relaxed) != value) {
+					state.store(value, std::memory_order_relaxed);
+				}
+			} else {
+				antiHashStatesNew<memberCount, value_type>[index] = value;
+			}
+		}
+	};
+
+	template<typename value_type, parse_options options> struct key_order {
+		static constexpr auto memberCount = coreTupleSize<value_type>;
+		using states						= anti_hash_states<options, memberCount, value_type>;
+
+		static key_order_profile dump() {
+			key_order_profile profile{};
+			profile.keys.reserve(memberCount);
+			for (uint64_t x = 0; x < memberCount; ++x) {
+				profile.keys.emplace_back(tupleRefs<value_type>[states::load(x)].key);
+			}
+			return profile;
+		}
+
+		static bool load(const key_order_profile& profile) {
+			if JSONIFIER_UNLIKELY (profile.keys.size() != memberCount) {
+				return false;
+			}
+			array<uint64_t, (memberCount > 0 ? memberCount : 1)> indices{};
+			for (uint64_t x = 0; x < memberCount; ++x) {
+				indices[x] = findIndex(profile.keys[x]);
+				if JSONIFIER_UNLIKELY (indices[x] >= memberCount) {
+					return false;
+				}
+			}
+			for (uint64_t x = 0; x < memberCount; ++x) {
+				states::store(x, indices[x]);
+			}
+			return true;
+		}
+
+	  protected:
+		static uint64_t findIndex(const string& key) noexcept {
+			for (uint64_t x = 0; x < memberCount; ++x) {
+				if (tupleRefs<value_type>[x].key == key) {
+					return x;
+				}
+			}
+			return memberCount;
+		}
+	};
+
+}
@@ -24,6 +24,10 @@
 
 #include <jsonifier-incl/utilities/number_utils.hpp>
 #include <jsonifier-incl/utilities/string_utils.hpp>
+#include <jsonifier-incl/utilities/interned_string.hpp>
+#include <jsonifier-incl/utilities/cached.hpp>
+#include <jsonifier-incl/utilities/json_fragment.hpp>
+#include <jsonifier-incl/utilities/string_enum.hpp>
 #include <jsonifier-incl/parsing/parser.hpp>
 
 namespace jsonifier::internal {
@@ -132,17 +136,6 @@ namespace jsonifier::internal {
 		}
 	};
 
-	template<uint64_t memberCount> constexpr array<uint64_t, (memberCount > 0 ? memberCount : 1)> generateAntiHashStatesTableNew() {
-		array<uint64_t, (memberCount > 0 ? memberCount : 1)> returnValues{};
-		for (uint64_t x = 0; x < memberCount; ++x) {
-			returnValues[x] = x;
-		}
-		return returnValues;
-	}
-
-	template<uint64_t memberCount, typename value_type>
-	thread_local constinit static array<uint64_t, (memberCount > 0 ? memberCount : 1)> antiHashStatesNew{ generateAntiHashStatesTableNew<memberCount>() };
-
 	template<template<typename, typename, parse_options> typename parsing_type, typename value_type, typename context_type, parse_options options>
 	static constexpr auto functionPtrsNew{ generateFunctionPtrsNew<parsing_type, value_type, context_type, options>(make_integer_sequence<coreTupleSize<value_type>>{}) };
 
@@ -154,26 +147,35 @@ namespace jsonifier::internal {
 		}
 	}
 
+	struct object_layout {
+		string_view_ptr indent{};
+		uint64_t indentSize{};
+	};
+
 	template<parse_options options, typename json_entity_type> struct json_entity_parse : public json_entity_type {
 		static constexpr auto memberCount{ coreTupleSize<typename json_entity_type::class_type> };
 
+		template<typename value_type, typename context_type> JSONIFIER_INLINE static parse_result parseKnownMember(value_type& value, context_type& context) {
+			static constexpr auto ptrNew = json_entity_type::memberPtr;
+			if constexpr (concepts::has_excluded_keys<value_type>) {
+				static constexpr auto key = escapedKeyLiteral<json_entity_type::name>.operator jsonifier::string_view();
+				const auto& keys		  = value.jsonifierExcludedKeys;
+				if JSONIFIER_UNLIKELY (keys.find(static_cast<typename remove_cvref_t<decltype(keys)>::key_type>(key)) != keys.end()) {
+					return context.skipValue() ? parse_result::active_member : parse_result::failed;
+				}
+			}
+			return parse<options>::impl(getMember<ptrNew>(value), context) ? parse_result::active_member : parse_result::failed;
+		}
+
 		template<typename value_type, typename context_type> JSONIFIER_INLINE static parse_result tryKnownOrder(value_type& value, context_type& context) {
 			static constexpr auto keyLiteral = escapedKeyLiteral<json_entity_type::name>;
-			static constexpr auto ptrNew	 = json_entity_type::memberPtr;
 			if constexpr (options.minified && !structural_context<context_type>) {
 				static constexpr auto memberLiteral		= makeMemberLiteralNew<json_entity_type::index>(keyLiteral);
 				static constexpr auto memberLiteralSize = memberLiteral.size();
 				if JSONIFIER_LIKELY (((context.currentPtr() + memberLiteralSize) < context.endPtr()) &&
 					string_literal_comparitor<decltype(memberLiteral), memberLiteral>::impl(context.currentPtr())) {
 					context.currentPtr() += memberLiteralSize;
-					if constexpr (concepts::has_excluded_keys<value_type>) {
-						static constexpr auto key = keyLiteral.operator jsonifier::string_view();
-						const auto& keys		  = value.jsonifierExcludedKeys;
-						if JSONIFIER_UNLIKELY (keys.find(static_cast<typename remove_cvref_t<decltype(keys)>::key_type>(key)) != keys.end()) {
-							return context.skipValue() ? parse_result::active_member : parse_result::failed;
-						}
-					}
-					return parse<options>::impl(getMember<ptrNew>(value), context) ? parse_result::active_member : parse_result::failed;
+					return parseKnownMember(value, context);
 				}
 				return parse_result::inactive_member;
 			} else {
@@ -181,7 +183,21 @@ namespace jsonifier::internal {
 			}
 		}
 
-		template<typename value_type, typename context_type> inline static bool processIndex(value_type& value, context_type& context) {
+		template<typename value_type, typename context_type>
+		JSONIFIER_INLINE static parse_result tryKnownOrderIndented(value_type& value, context_type& context, const object_layout& layout) {
+			static constexpr auto memberLiteral		= makeFusedKeyLiteral(escapedKeyLiteral<json_entity_type::name>);
+			static constexpr auto memberLiteralSize = memberLiteral.size();
+			const auto ptr							= context.currentPtr();
+			const auto literalPtr					= ptr + 1 + layout.indentSize;
+			if JSONIFIER_LIKELY (((literalPtr + memberLiteralSize) < context.endPtr()) && *ptr == ',' && std::memcmp(ptr + 1, layout.indent, layout.indentSize) == 0 &&
+				string_literal_comparitor<decltype(memberLiteral), memberLiteral>::impl(literalPtr)) {
+				context.currentPtr() = literalPtr + memberLiteralSize;
+				return parseKnownMember(value, context);
+			}
+			return parse_result::inactive_member;
+		}
+
+		template<typename value_type, typename context_type> inline static bool processIndex(value_type& value, context_type& context, [[maybe_unused]] const object_layout& layout) {
 			if constexpr (options.minified && options.knownOrder && !structural_context<context_type>) {
 				if (context.objectMaybeEnd()) {
 					return false;
@@ -196,6 +212,11 @@ namespace jsonifier::internal {
 				}
 			} else {
 				if constexpr (json_entity_type::index > 0) {
+					if constexpr (options.knownOrder && !options.minified && !structural_context<context_type>) {
+						if (auto result = tryKnownOrderIndented(value, context, layout); result != parse_result::inactive_member) {
+							return result == parse_result::active_member;
+						}
+					}
 					switch (static_cast<uint64_t>(context.collectObjectSeparator())) {
 						case static_cast<uint64_t>(sep_result::cont): {
 							break;
@@ -225,7 +246,7 @@ namespace jsonifier::internal {
 						return result == parse_result::active_member;
 					}
 				} else {
-					if JSONIFIER_LIKELY (auto indexNew = antiHashStatesNew<memberCount, value_type>[json_entity_type::index]; indexNew < memberCount) {
+					if JSONIFIER_LIKELY (auto indexNew = anti_hash_states<options, memberCount, value_type>::load(json_entity_type::index); indexNew < memberCount) {
 						if (auto result =
 								generateDispatchTableNew<parse_types_impl, value_type, context_type, options, make_integer_sequence<memberCount>>::impl(value, context, indexNew);
 							result != parse_result::inactive_member) {
@@ -238,7 +259,7 @@ namespace jsonifier::internal {
 								result2 != parse_result::inactive_member) {
 								if constexpr (options.knownOrder) {
 									if (result2 == parse_result::active_member) {
-										antiHashStatesNew<memberCount, value_type>[json_entity_type::index] = indexNew2;
+										anti_hash_states<options, memberCount, value_type>::store(json_entity_type::index, indexNew2);
 									}
 								}
 								return result2 == parse_result::active_member;
@@ -249,6 +270,7 @@ namespace jsonifier::internal {
 				if JSONIFIER_UNLIKELY (!context.template checkChar<'"'>()) {
 					return context.template reject<parse_statuses::missing_key_start>();
 				}
+				[[maybe_unused]] const string_view_ptr skipStart = context.currentPtr();
 				if JSONIFIER_UNLIKELY (!context.skipString()) {
 					return false;
 				}
@@ -258,6 +280,9 @@ namespace jsonifier::internal {
 				if JSONIFIER_UNLIKELY (!context.skipValue()) {
 					return false;
 				}
+				if constexpr (options.adaptiveRead) {
+					recordSkippedBytes(skipStart, context.currentPtr());
+				}
 				switch (static_cast<uint64_t>(context.collectObjectSeparator())) {
 					case static_cast<uint64_t>(sep_result::cont): {
 						break;
@@ -293,10 +318,17 @@ namespace jsonifier::internal {
 	template<concepts::jsonifier_object_t value_type, typename context_type, parse_options options> struct parse_impl<value_type, context_type, options> {
 		inline static bool rootImpl(value_type& value, context_type& context) noexcept {
 			if JSONIFIER_LIKELY (context.objectStart()) {
+				object_layout layout{};
+				if constexpr (options.knownOrder && !options.minified && !structural_context<context_type>) {
+					layout.indent = context.currentPtr();
+				}
 				if JSONIFIER_UNLIKELY (context.objectMaybeEnd()) {
 					return true;
 				}
-				if (parse_base_t<options, value_type, context_type>::iterateValues(value, context)) {
+				if constexpr (options.knownOrder && !options.minified && !structural_context<context_type>) {
+					layout.indentSize = static_cast<uint64_t>(context.currentPtr() - layout.indent);
+				}
+				if (parse_base_t<options, value_type, context_type>::iterateValues(value, context, layout)) {
 					if (context.objectMaybeEnd()) {
 						return true;
 					}
@@ -306,7 +338,14 @@ namespace jsonifier::internal {
 					if constexpr (!options.minified && !structural_context<context_type>) {
 						context.skipWhitespace();
 					}
-					return context.skipRemainingObject();
+					if constexpr (options.adaptiveRead) {
+						const string_view_ptr skipStart = context.currentPtr();
+						const bool result				= context.skipRemainingObject();
+						recordSkippedBytes(skipStart, context.currentPtr());
+						return result;
+					} else {
+						return context.skipRemainingObject();
+					}
 				}
 				return context.getErrors().size() == 0;
 			} else {
@@ -337,14 +376,30 @@ namespace jsonifier::internal {
 					return true;
 				}
 				while (true) {
-					if JSONIFIER_UNLIKELY (!parse<options>::impl(getKeyNew<typename value_type::key_type>(), context)) {
-						return false;
-					}
-					if JSONIFIER_UNLIKELY (!context.collectObjectColon()) {
-						return false;
-					}
-					if JSONIFIER_UNLIKELY (!parse<options>::impl(value[getKeyNew<typename value_type::key_type>()], context)) {
-						return false;
+					if constexpr (concepts::key_view_emplaceable<value_type>) {
+						if constexpr (!options.minified && !structural_context<context_type>) {
+							context.skipWhitespace();
+						}
+						if JSONIFIER_UNLIKELY (!context.template checkChar<'"'>()) {
+							return context.template reject<parse_statuses::invalid_string_characters>();
+						}
+						string_view key{};
+						if JSONIFIER_UNLIKELY (!context.iterateStringView(key) || !context.collectObjectColon()) {
+							return false;
+						}
+						if JSONIFIER_UNLIKELY (!parse<options>::impl(value.try_emplace(std::string_view{ key.data(), key.size() }).first->second, context)) {
+							return false;
+						}
+					} else {
+						if JSONIFIER_UNLIKELY (!parse<options>::impl(getKeyNew<typename value_type::key_type>(), context)) {
+							return false;
+						}
+						if JSONIFIER_UNLIKELY (!context.collectObjectColon()) {
+							return false;
+						}
+						if JSONIFIER_UNLIKELY (!parse<options>::impl(value[getKeyNew<typename value_type::key_type>()], context)) {
+							return false;
+						}
 					}
 					switch (static_cast<uint64_t>(context.collectObjectSeparator())) {
 						case static_cast<uint64_t>(sep_result::cont): {
@@ -367,6 +422,93 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<typename context_type>
+	concept raw_input_context = std::same_as<decltype(std::declval<context_type&>().currentPtr()), string_view_ptr&>;
+
+	template<parse_options options> struct numeric_array_parser {
+		static constexpr uint64_t initialCapacity{ 64 };
+		static constexpr int64_t blockSpan{ 128 };
+
+		template<concepts::batch_numeric_t value_type, raw_input_context context_type> JSONIFIER_INLINE static bool parseValue(value_type& value, context_type& context) noexcept {
+			string_view_ptr& iter = context.currentPtr();
+			if JSONIFIER_LIKELY (const string_view_ptr iterNew = batch_number_parser<value_type>::impl(value, iter, context.endPtr()); iterNew) {
+				iter = iterNew;
+				return true;
+			}
+			return context.iterateNumber(value);
+		}
+
+		template<concepts::vector_t value_type> JSONIFIER_INLINE static void grow(value_type& value, uint64_t& capacity) noexcept {
+			capacity = std::max(capacity * 2, initialCapacity);
+			value.resize(capacity);
+		}
+
+		template<concepts::vector_t value_type, raw_input_context context_type>
+		JSONIFIER_INLINE static bool parseBlocks(value_type& value, uint64_t& capacity, uint64_t& newSize, context_type& context) noexcept {
+			using element_type	  = typename value_type::value_type;
+			string_view_ptr& iter = context.currentPtr();
+			const string_view_ptr end{ context.endPtr() };
+			bool progressed{};
+			while (end - iter >= blockSpan) {
+				const string_view_ptr blockStart{ iter };
+				uint64_t commas{ collectByteMask<','>(blockStart) };
+				if (capacity - newSize < 64) {
+					grow(value, capacity);
+				}
+				auto* data = value.data() + newSize;
+				while (commas) {
+					const string_view_ptr separator{ blockStart + simd::tzcnt(commas) };
+					if JSONIFIER_UNLIKELY (batch_number_parser<element_type>::impl(*data, iter, end) != separator) {
+						return progressed;
+					}
+					++data;
+					++newSize;
+					iter	   = separator + 1;
+					progressed = true;
+					commas	   = simd::blsr(commas);
+				}
+				if JSONIFIER_UNLIKELY (iter == blockStart) {
+					return progressed;
+				}
+			}
+			return progressed;
+		}
+
+		template<concepts::vector_t value_type, raw_input_context context_type> inline static bool impl(value_type& value, context_type& context) noexcept {
+			uint64_t capacity{ value.size() };
+			uint64_t newSize{};
+			bool blocks{ true };
+			while (context.notAtEndPre()) {
+				if (blocks) {
+					blocks = parseBlocks(value, capacity, newSize, context);
+				}
+				if JSONIFIER_UNLIKELY (newSize == capacity) {
+					grow(value, capacity);
+				}
+				if JSONIFIER_UNLIKELY (!parseValue(value.data()[newSize], context)) {
+					value.resize(newSize);
+					return false;
+				}
+				++newSize;
+				switch (static_cast<uint64_t>(context.collectArraySeparator())) {
+					case static_cast<uint64_t>(sep_result::cont): {
+						continue;
+					}
+					case static_cast<uint64_t>(sep_result::ended): {
+						value.resize(newSize);
+						return true;
+					}
+					default: {
+						value.resize(newSize);
+						return false;
+					}
+				}
+			}
+			value.resize(newSize);
+			return context.template reject<parse_statuses::unexpected_string_end>();
+		}
+	};
+
 	template<concepts::vector_t value_type, typename context_type, parse_options optionsNew> struct parse_impl<value_type, context_type, optionsNew> {
 		static constexpr parse_options options{ optionsNew };
 		inline static bool rootImpl(value_type& value, context_type& context) noexcept {
@@ -375,6 +517,11 @@ namespace jsonifier::internal {
 					value.clear();
 					return true;
 				}
+				if constexpr (concepts::batch_numeric_t<typename value_type::value_type> && raw_input_context<context_type>) {
+					return numeric_array_parser<options>::impl(value, context);
+				} else if constexpr (options.reuseStorage) {
+					return reuseImpl(value, context);
+				}
 #if JSONIFIER_COMPILER_CLANG
 	#pragma clang diagnostic push
 	#pragma clang diagnostic ignored "-Wexit-time-destructors"
@@ -435,6 +582,48 @@ namespace jsonifier::internal {
 				return false;
 			}
 		}
+
+		inline static bool reuseImpl(value_type& value, context_type& context) noexcept {
+			const uint64_t oldSize{ value.size() };
+			uint64_t newSize{};
+			auto beginIter = getBeginIterVec(value);
+			while (newSize < oldSize) {
+				if JSONIFIER_UNLIKELY (!parse<options>::impl(beginIter[static_cast<int64_t>(newSize)], context)) {
+					return false;
+				}
+				++newSize;
+				switch (static_cast<uint64_t>(context.collectArraySeparator())) {
+					case static_cast<uint64_t>(sep_result::cont): {
+						continue;
+					}
+					case static_cast<uint64_t>(sep_result::ended): {
+						value.resize(newSize);
+						return true;
+					}
+					default: {
+						return false;
+					}
+				}
+			}
+			while (context.notAtEndPre()) {
+				if JSONIFIER_UNLIKELY (!parse<options>::impl(value.emplace_back(), context)) {
+					return false;
+				}
+				switch (static_cast<uint64_t>(context.collectArraySeparator())) {
+					case static_cast<uint64_t>(sep_result::cont): {
+						continue;
+					}
+					case static_cast<uint64_t>(sep_result::ended): {
+						return true;
+					}
+					default: {
+						return false;
+					}
+				}
+			}
+			return context.template reject<parse_statuses::unexpected_string_end>();
+		}
+
 		JSONIFIER_INLINE static bool impl(value_type& value, context_type& context) noexcept {
 			return rootImpl(value, context);
 		}
@@ -555,6 +744,27 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<concepts::interned_string_t value_type, typename context_type, parse_options options> struct parse_impl<value_type, context_type, options> {
+		JSONIFIER_INLINE static bool rootImpl(value_type& value, context_type& context) noexcept {
+			if constexpr (!options.minified && !structural_context<context_type>) {
+				context.skipWhitespace();
+			}
+			if JSONIFIER_UNLIKELY (!context.template checkChar<'"'>()) {
+				return context.template reject<parse_statuses::invalid_string_characters>();
+			}
+			string_view newValue{};
+			if JSONIFIER_UNLIKELY (!context.iterateStringView(newValue)) {
+				return false;
+			}
+			value = currentStringPool().intern(std::string_view{ newValue.data(), newValue.size() });
+			return true;
+		}
+
+		JSONIFIER_INLINE static bool impl(value_type& value, context_type& context) noexcept {
+			return rootImpl(value, context);
+		}
+	};
+
 	template<concepts::char_t value_type, typename context_type, parse_options options> struct parse_impl<value_type, context_type, options> {
 		JSONIFIER_INLINE static bool rootImpl(value_type& value, context_type& context) noexcept {
 			if JSONIFIER_LIKELY (context.hasMoreInput()) {
@@ -597,6 +807,39 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<concepts::string_enum_t value_type, typename context_type, parse_options options> struct parse_impl<value_type, context_type, options> {
+		using enum_data = string_enum_data<value_type>;
+
+		JSONIFIER_INLINE static bool rootImpl(value_type& value, context_type& context) noexcept {
+			if constexpr (!options.minified && !structural_context<context_type>) {
+				context.skipWhitespace();
+			}
+			if (!context.template checkChar<'"'>()) {
+				uint64_t newValue{};
+				if JSONIFIER_LIKELY (context.iterateNumber(newValue)) {
+					value = static_cast<value_type>(newValue);
+					return true;
+				}
+				return false;
+			}
+			const string_view_ptr start = context.currentPtr() + 1;
+			const string_view_ptr end	= context.endPtr();
+			const uint64_t index		= hash_map<value_type, string_view_ptr>::findIndex(start, end);
+			if JSONIFIER_LIKELY (index < enum_data::count) {
+				const string_view name{ enum_data::quotedNames[index] };
+				if JSONIFIER_LIKELY (static_cast<uint64_t>(end - start) >= name.size() - 1 && std::memcmp(start, name.data() + 1, name.size() - 1) == 0) {
+					value = enum_data::values[index];
+					return context.skipString();
+				}
+			}
+			return context.template reject<parse_statuses::invalid_enum_value>();
+		}
+
+		JSONIFIER_INLINE static bool impl(value_type& value, context_type& context) noexcept {
+			return rootImpl(value, context);
+		}
+	};
+
 	template<concepts::num_t value_type, typename context_type, parse_options options> struct parse_impl<value_type, context_type, options> {
 		JSONIFIER_INLINE static bool rootImpl(value_type& value, context_type& context) noexcept {
 			return context.iterateRootNumber(value);
@@ -628,22 +871,165 @@ namespace jsonifier::internal {
 	};
 
 	template<concepts::variant_t value_type, typename context_type, parse_options options> struct parse_impl<value_type, context_type, options> {
+		template<typename element_type, uint64_t currentIndex, typename variant_type> JSONIFIER_INLINE static element_type& getAlternative(variant_type&& variant) noexcept {
+			if constexpr (options.reuseStorage) {
+				if (variant.index() == currentIndex) {
+					return std::get<currentIndex>(variant);
+				}
+			}
+			return variant.template emplace<element_type>(element_type{});
+		}
+
+		static constexpr uint64_t alternativeCount{ std::variant_size_v<value_type> };
+
+		template<uint64_t index> using alternative_type = std::variant_alternative_t<index, value_type>;
+
+		template<uint64_t... indices> static constexpr uint64_t collectObjectMask(integer_sequence<indices...>) noexcept {
+			return (((indices < 64 && concepts::jsonifier_object_t<alternative_type<indices>>) ? (1ull << (indices & 63)) : 0ull) | ... | 0ull);
+		}
+
+		static constexpr uint64_t objectMask{ collectObjectMask(make_integer_sequence<alternativeCount>{}) };
+
+		JSONIFIER_INLINE static bool keyEquals(string_view_ptr keyStart, string_view_ptr end, const string_view& key) noexcept {
+			return static_cast<uint64_t>(end - keyStart) > key.size() && std::memcmp(keyStart, key.data(), key.size()) == 0 && keyStart[key.size()] == '"';
+		}
+
+		template<typename element_type> JSONIFIER_INLINE static bool hasKey(string_view_ptr keyStart, string_view_ptr end) noexcept {
+			if constexpr (!concepts::jsonifier_object_t<element_type>) {
+				return false;
+			} else if constexpr (tupleReferences<element_type>.count == 0) {
+				return false;
+			} else {
+				const uint64_t index = hash_map<element_type, string_view_ptr>::findIndex(keyStart, end);
+				return index < tupleReferences<element_type>.count && keyEquals(keyStart, end, tupleRefs<element_type>[index].key);
+			}
+		}
+
+		template<uint64_t... indices> JSONIFIER_INLINE static uint64_t collectKeyMask(string_view_ptr keyStart, string_view_ptr end, integer_sequence<indices...>) noexcept {
+			return ((hasKey<alternative_type<indices>>(keyStart, end) ? (1ull << indices) : 0ull) | ... | 0ull);
+		}
+
+		template<uint64_t index> JSONIFIER_INLINE static bool parseAlternative(value_type& value, context_type& context) noexcept {
+			return parse<options>::impl(getAlternative<alternative_type<index>, index>(value), context);
+		}
+
+		template<uint64_t... indices> JSONIFIER_INLINE static bool parseIndex(value_type& value, context_type& context, uint64_t index, integer_sequence<indices...>) noexcept {
+			return ((index == indices && parseAlternative<indices>(value, context)) || ...);
+		}
+
+		JSONIFIER_INLINE static bool selectTagged(uint64_t& index, context_type peek) noexcept {
+			static constexpr string_view tagKey{ core<value_type>::tagKey.data(), core<value_type>::tagKey.size() };
+			if JSONIFIER_UNLIKELY (!peek.objectStart()) {
+				return false;
+			}
+			if JSONIFIER_UNLIKELY (peek.objectMaybeEnd()) {
+				return peek.template reject<parse_statuses::invalid_variant_tag>();
+			}
+			while (true) {
+				if constexpr (!options.minified && !structural_context<context_type>) {
+					peek.skipWhitespace();
+				}
+				if JSONIFIER_UNLIKELY (!peek.template checkChar<'"'>()) {
+					return peek.template reject<parse_statuses::missing_key_start>();
+				}
+				const bool isTag = keyEquals(peek.currentPtr() + 1, peek.endPtr(), tagKey);
+				if JSONIFIER_UNLIKELY (!peek.skipString() || !peek.collectObjectColon()) {
+					return false;
+				}
+				if (isTag) {
+					if constexpr (!options.minified && !structural_context<context_type>) {
+						peek.skipWhitespace();
+					}
+					if JSONIFIER_LIKELY (peek.template checkChar<'"'>()) {
+						const string_view_ptr start = peek.currentPtr() + 1;
+						index						= hash_map<value_type, string_view_ptr>::findIndex(start, peek.endPtr());
+						if JSONIFIER_LIKELY (index < alternativeCount && keyEquals(start, peek.endPtr(), tupleRefs<value_type>[index].key)) {
+							return true;
+						}
+					}
+					return peek.template reject<parse_statuses::invalid_variant_tag>();
+				}
+				if JSONIFIER_UNLIKELY (!peek.skipValue()) {
+					return false;
+				}
+				switch (static_cast<uint64_t>(peek.collectObjectSeparator())) {
+					case static_cast<uint64_t>(sep_result::cont): {
+						continue;
+					}
+					case static_cast<uint64_t>(sep_result::ended): {
+						return peek.template reject<parse_statuses::invalid_variant_tag>();
+					}
+					default: {
+						return false;
+					}
+				}
+			}
+		}
+
+		JSONIFIER_INLINE static bool selectByKeys(uint64_t& index, context_type peek) noexcept {
+			uint64_t candidates{ objectMask };
+			if JSONIFIER_UNLIKELY (!peek.objectStart()) {
+				return false;
+			}
+			if (!peek.objectMaybeEnd()) {
+				while (true) {
+					if constexpr (!options.minified && !structural_context<context_type>) {
+						peek.skipWhitespace();
+					}
+					if JSONIFIER_UNLIKELY (!peek.template checkChar<'"'>()) {
+						return peek.template reject<parse_statuses::missing_key_start>();
+					}
+					const uint64_t keyMask = collectKeyMask(peek.currentPtr() + 1, peek.endPtr(), make_integer_sequence<alternativeCount>{});
+					candidates			   = (candidates & keyMask) ? (candidates & keyMask) : candidates;
+					if ((candidates & (candidates - 1)) == 0) {
+						break;
+					}
+					if JSONIFIER_UNLIKELY (!peek.skipString() || !peek.collectObjectColon() || !peek.skipValue()) {
+						return false;
+					}
+					const auto result = peek.collectObjectSeparator();
+					if (result == sep_result::cont) {
+						continue;
+					} else if (result == sep_result::ended) {
+						break;
+					}
+					return false;
+				}
+			}
+			index = static_cast<uint64_t>(std::countr_zero(candidates));
+			return true;
+		}
+
+		JSONIFIER_INLINE static bool parseObject(value_type& value, context_type& context) noexcept {
+			if constexpr (concepts::tagged_variant_t<value_type>) {
+				static_assert(tuple_size_v<decltype(core<value_type>::variantTags)> == alternativeCount, "A tagged variant needs exactly one tag per alternative.");
+				uint64_t index{};
+				return selectTagged(index, context) && parseIndex(value, context, index, make_integer_sequence<alternativeCount>{});
+			} else if constexpr ((objectMask & (objectMask - 1)) != 0) {
+				static_assert(alternativeCount <= 64, "Key-set inference supports at most 64 alternatives.");
+				uint64_t index{};
+				return selectByKeys(index, context) && parseIndex(value, context, index, make_integer_sequence<alternativeCount>{});
+			} else {
+				return iterateVariantTypes<json_type::object>(value, context);
+			}
+		}
+
 		template<json_type type, typename variant_type, uint64_t currentIndex = 0>
 		inline static bool iterateVariantTypes(variant_type&& variant, context_type& context) noexcept {
 			if constexpr (currentIndex < std::variant_size_v<remove_cvref_t<variant_type>>) {
 				using element_type = remove_cvref_t<decltype(std::get<currentIndex>(std::declval<remove_cvref_t<variant_type>>()))>;
 				if constexpr (concepts::jsonifier_object_t<element_type> && type == json_type::object) {
-					return parse<options>::impl(variant.template emplace<element_type>(element_type{}), context);
+					return parse<options>::impl(getAlternative<element_type, currentIndex>(variant), context);
 				} else if constexpr ((concepts::vector_t<element_type> || concepts::raw_array_t<element_type>) && type == json_type::array) {
-					return parse<options>::impl(variant.template emplace<element_type>(element_type{}), context);
+					return parse<options>::impl(getAlternative<element_type, currentIndex>(variant), context);
 				} else if constexpr ((concepts::string_t<element_type> || concepts::string_view_t<element_type>) && type == json_type::string) {
-					return parse<options>::impl(variant.template emplace<element_type>(element_type{}), context);
+					return parse<options>::impl(getAlternative<element_type, currentIndex>(variant), context);
 				} else if constexpr (concepts::bool_t<element_type> && type == json_type::boolean) {
-					return parse<options>::impl(variant.template emplace<element_type>(element_type{}), context);
+					return parse<options>::impl(getAlternative<element_type, currentIndex>(variant), context);
 				} else if constexpr ((concepts::num_t<element_type> || concepts::enum_t<element_type>) && type == json_type::number) {
-					return parse<options>::impl(variant.template emplace<element_type>(element_type{}), context);
+					return parse<options>::impl(getAlternative<element_type, currentIndex>(variant), context);
 				} else if constexpr (concepts::always_null_t<element_type> && type == json_type::null) {
-					return parse<options>::impl(variant.template emplace<element_type>(element_type{}), context);
+					return parse<options>::impl(getAlternative<element_type, currentIndex>(variant), context);
 				} else {
 					return iterateVariantTypes<type, variant_type, currentIndex + 1>(variant, context);
 				}
@@ -659,7 +1045,7 @@ namespace jsonifier::internal {
 			if JSONIFIER_LIKELY (context.hasMoreInput()) {
 				switch (static_cast<uint8_t>(*context.currentPtr())) {
 					case '{': {
-						return iterateVariantTypes<json_type::object>(value, context);
+						return parseObject(value, context);
 					}
 					case '[': {
 						return iterateVariantTypes<json_type::array>(value, context);
@@ -721,7 +1107,11 @@ namespace jsonifier::internal {
 	template<concepts::optional_t value_type, typename context_type, parse_options options> struct parse_impl<value_type, context_type, options> {
 		JSONIFIER_INLINE static bool rootImpl(value_type& value, context_type& context) noexcept {
 			if JSONIFIER_LIKELY (!isNullValue<context_type, options>(context)) {
-				return parse<options>::impl(value.emplace(), context);
+				if constexpr (options.reuseStorage) {
+					return parse<options>::impl(value.has_value() ? *value : value.emplace(), context);
+				} else {
+					return parse<options>::impl(value.emplace(), context);
+				}
 			} else {
 				value.reset();
 				return context.iterateNull();
@@ -732,6 +1122,15 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<concepts::cached_t value_type, typename context_type, parse_options options> struct parse_impl<value_type, context_type, options> {
+		JSONIFIER_INLINE static bool rootImpl(value_type& value, context_type& context) noexcept {
+			return parse<options>::impl(value.mutate(), context);
+		}
+		JSONIFIER_INLINE static bool impl(value_type& value, context_type& context) noexcept {
+			return rootImpl(value, context);
+		}
+	};
+
 	template<concepts::shared_ptr_t value_type, typename context_type, parse_options options> struct parse_impl<value_type, context_type, options> {
 		JSONIFIER_INLINE static bool rootImpl(value_type& value, context_type& context) noexcept {
 			if JSONIFIER_LIKELY (!isNullValue<context_type, options>(context)) {
@@ -782,6 +1181,34 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<concepts::json_fragment_t value_type, typename context_type, parse_options options> struct parse_impl<value_type, context_type, options> {
+		JSONIFIER_INLINE static bool rootImpl(value_type& value, context_type& context) noexcept {
+			if constexpr (!options.minified && !structural_context<context_type>) {
+				context.skipWhitespace();
+			}
+			if JSONIFIER_LIKELY (context.hasMoreInput()) {
+				string_view_ptr newPtr = context.currentPtr();
+				if JSONIFIER_UNLIKELY (!context.skipValue()) {
+					return false;
+				}
+				string_view_ptr endPtr = context.notAtEndPre() ? context.currentPtr() : context.endPtr();
+				uint64_t newSize	   = static_cast<uint64_t>(endPtr - newPtr);
+				if constexpr (!options.minified) {
+					while (newSize > 0 && whitespaceTable[static_cast<uint8_t>(newPtr[newSize - 1])]) {
+						--newSize;
+					}
+				}
+				value = value_type{ std::string_view{ newPtr, newSize } };
+				return true;
+			} else {
+				return false;
+			}
+		}
+		JSONIFIER_INLINE static bool impl(value_type& value, context_type& context) noexcept {
+			return rootImpl(value, context);
+		}
+	};
+
 	template<concepts::raw_json_t value_type, typename context_type, parse_options options> struct parse_impl<value_type, context_type, options> {
 		JSONIFIER_INLINE static bool rootImpl([[maybe_unused]] value_type& value, context_type& context) noexcept {
 			if constexpr (!options.minified && !structural_context<context_type>) {
@@ -790,18 +1217,15 @@ namespace jsonifier::internal {
 			if JSONIFIER_LIKELY (context.hasMoreInput()) {
 				string_view_ptr newPtr = context.currentPtr();
 				[[maybe_unused]] string_view_ptr stringRoot{};
+				[[maybe_unused]] const uint32_t* tapeStart{};
 				if constexpr (structural_context<context_type>) {
 					stringRoot = context.currentPtr() - *context.currentIterPtr();
+					tapeStart  = context.currentIterPtr();
 				}
 				if JSONIFIER_UNLIKELY (!context.skipValue()) {
 					return false;
 				}
-				string_view_ptr endPtr;
-				if constexpr (structural_context<context_type>) {
-					endPtr = context.notAtEndPre() ? context.currentPtr() : stringRoot + *context.endPtr();
-				} else {
-					endPtr = context.notAtEndPre() ? context.currentPtr() : context.endPtr();
-				}
+				string_view_ptr endPtr = context.notAtEndPre() ? context.currentPtr() : context.endPtr();
 				uint64_t newSize = static_cast<uint64_t>(endPtr - newPtr);
 				if constexpr (!options.minified) {
 					while (newSize > 0 && whitespaceTable[static_cast<uint8_t>(newPtr[newSize - 1])]) {
@@ -809,10 +1233,14 @@ namespace jsonifier::internal {
 					}
 				}
 				if JSONIFIER_LIKELY (newSize > 0) {
-					string newString{};
-					newString.resize(newSize);
-					std::memcpy(newString.data(), newPtr, newSize);
-					value = value_type{ context, newString };
+					if constexpr (structural_context<context_type>) {
+						return value.template build<options>(context, newPtr, newSize, tapeStart, static_cast<uint64_t>(context.currentIterPtr() - tapeStart),
+							static_cast<uint32_t>(newPtr - stringRoot));
+					} else {
+						static thread_local simd_string_reader<1024 * 16> section{};
+						section.template reset<false>(newPtr, newSize);
+						return value.template build<options>(context, newPtr, newSize, section.begin(), section.getTapeCount(), 0);
+					}
 				}
 				return true;
 			} else {
@@ -23,15 +23,34 @@
 #pragma once
 
 #include <jsonifier-incl/utilities/json_entity.hpp>
+#include <jsonifier-incl/parsing/key_order.hpp>
+#include <jsonifier-incl/parsing/read_route.hpp>
 #include <jsonifier-incl/parsing/validator.hpp>
 #include <jsonifier-incl/utilities/hash_map.hpp>
+#include <jsonifier-incl/utilities/interned_string.hpp>
 #include <jsonifier-incl/utilities/number_utils.hpp>
 #include <jsonifier-incl/utilities/string.hpp>
 #include <jsonifier-incl/utilities/error.hpp>
 #include <jsonifier-incl/utilities/simd.hpp>
 
+namespace jsonifier {
+
+	template<typename derived_type> class document;
+
+}
+
 namespace jsonifier::internal {
 
+	template<string_literal path, parse_options options> struct json_pointer_extract;
+
+	template<parse_options options> static constexpr parse_options extractOptions{ [] {
+		parse_options returnValues{ options };
+		returnValues.partialRead	= false;
+		returnValues.detectMinified = false;
+		returnValues.adaptiveRead	= false;
+		return returnValues;
+	}() };
+
 	template<typename value_type> [[maybe_unused]] JSONIFIER_INLINE static auto getBeginIterVec(value_type& value JSONIFIER_LIFETIME_BOUND) {
 		if constexpr (std::is_same_v<typename value_type::value_type, bool>) {
 			return value.begin();
@@ -100,13 +119,111 @@ namespace jsonifier::internal {
 
 		template<parse_options options = parse_options{}, typename value_type, typename buffer_type> inline bool parseJson(value_type&& object, buffer_type&& in) noexcept {
 			static constexpr parse_options parseOpts{ options };
+			if constexpr (parseOpts.detectMinified) {
+				static constexpr parse_options minifiedOpts{ [] {
+					parse_options returnValues{ parseOpts };
+					returnValues.detectMinified = false;
+					returnValues.minified		= true;
+					return returnValues;
+				}() };
+				static constexpr parse_options prettifiedOpts{ [] {
+					parse_options returnValues{ parseOpts };
+					returnValues.detectMinified = false;
+					returnValues.minified		= false;
+					return returnValues;
+				}() };
+				auto rootIter = getBeginIter(in);
+				auto endIter  = getEndIter(in);
+				if (minified_detector::impl(rootIter, static_cast<uint64_t>(endIter - rootIter))) {
+					if JSONIFIER_LIKELY (parseJson<minifiedOpts>(object, in)) {
+						return true;
+					}
+					if (getErrors().size() > 0 &&
+						!minified_detector::rejectedByWhitespace(rootIter, static_cast<uint64_t>(endIter - rootIter), getErrors().front().getErrorIndex())) {
+						return false;
+					}
+				}
+				return parseJson<prettifiedOpts>(object, in);
+			} else if constexpr (parseOpts.adaptiveRead) {
+				static constexpr parse_options twoStageOpts{ [] {
+					parse_options returnValues{ parseOpts };
+					returnValues.partialRead = true;
+					return returnValues;
+				}() };
+				static constexpr parse_options singlePassOpts{ [] {
+					parse_options returnValues{ parseOpts };
+					returnValues.partialRead = false;
+					return returnValues;
+				}() };
+				using route_type  = read_route<remove_cvref_t<value_type>, parseOpts>;
+				auto rootIter	  = getBeginIter(in);
+				auto endIter	  = getEndIter(in);
+				const auto length = static_cast<uint64_t>(endIter - rootIter);
+				route_type::begin();
+				const bool result = route_type::useTwoStage(length) ? parseJsonImpl<twoStageOpts>(object, in) : parseJsonImpl<singlePassOpts>(object, in);
+				route_type::record(length);
+				return result;
+			} else {
+				return parseJsonImpl<parseOpts>(object, in);
+			}
+		}
+
+		template<parse_options options = parse_options{}, typename buffer_type> inline document<derived_type> iterate(buffer_type&& in) noexcept {
+			static constexpr parse_options parseOpts{ options };
+			auto rootIter = getBeginIter(in);
+			auto endIter  = getEndIter(in);
+			derivedRef.section.template reset<parseOpts.minified>(rootIter, static_cast<uint64_t>(endIter - rootIter));
+			auto newSize = static_cast<uint64_t>(endIter - rootIter);
+			if (getStringBuffer().size() < newSize) {
+				getStringBuffer().resize(newSize);
+			}
+			getErrors().clear();
+			if JSONIFIER_UNLIKELY (rootIter == endIter || derivedRef.section.getTapeCount() == 0) {
+				getErrors().emplace_back(error::constructError<status_classes::parsing, parse_statuses::no_input>(rootIter, rootIter, endIter));
+			}
+			return document<derived_type>{ &derivedRef, derivedRef.section.begin(), derivedRef.section.end(), rootIter, endIter };
+		}
+
+		template<string_literal path, parse_options options = parse_options{}, typename buffer_type, typename value_type>
+		inline bool extract(buffer_type&& in, value_type&& value) noexcept {
+			return json_pointer_extract<path, extractOptions<options>>::rootImpl(value, getBeginIter(in), getEndIter(in), getStringBuffer(), getErrors());
+		}
+
+		template<parse_options options = parse_options{}, typename query_type, typename buffer_type> inline bool query(query_type& queryNew, buffer_type&& in) noexcept {
+			static constexpr parse_options parseOpts{ options };
+			auto rootIter = getBeginIter(in);
+			auto endIter  = getEndIter(in);
+			derivedRef.section.template reset<parseOpts.minified>(rootIter, static_cast<uint64_t>(endIter - rootIter));
+			getErrors().clear();
+			if JSONIFIER_UNLIKELY (rootIter == endIter || derivedRef.section.getTapeCount() == 0) {
+				getErrors().emplace_back(error::constructError<status_classes::parsing, parse_statuses::no_input>(rootIter, rootIter, endIter));
+				return false;
+			}
+			return queryNew.run(derivedRef.section.begin(), derivedRef.section.end(), rootIter, endIter, getErrors(), static_cast<uint64_t>(parseOpts.maxDepth));
+		}
+
+		template<typename value_type, parse_options options = parse_options{}> inline key_order_profile dumpKeyOrder() const {
+			return key_order<remove_cvref_t<value_type>, options>::dump();
+		}
+
+		template<typename value_type, parse_options options = parse_options{}> inline bool loadKeyOrder(const key_order_profile& profile) noexcept {
+			return key_order<remove_cvref_t<value_type>, options>::load(profile);
+		}
+
+		template<typename value_type, parse_options options = parse_options{}> inline bool usesTwoStageRead(uint64_t length) const noexcept {
+			return read_route<remove_cvref_t<value_type>, options>::useTwoStage(length);
+		}
+
+	  protected:
+		template<parse_options parseOpts, typename value_type, typename buffer_type> inline bool parseJsonImpl(value_type&& object, buffer_type&& in) noexcept {
+			const string_pool_scope poolScope{ derivedRef.stringPool.get() };
 			if constexpr (parseOpts.partialRead) {
 				auto rootIter = getBeginIter(in);
 				auto endIter  = getEndIter(in);
 				derivedRef.section.template reset<parseOpts.minified>(rootIter, static_cast<uint64_t>(endIter - rootIter));
 				json_iterator<parseOpts, structural_index_ptr, remove_reference_t<decltype(getStringBuffer())>> context{ &getStringBuffer(), &getErrors(),
 					derivedRef.section.begin(), derivedRef.section.end(), derivedRef.section.begin(), rootIter, endIter };
-				auto newSize = static_cast<uint64_t>(*endIter);
+				auto newSize = static_cast<uint64_t>(endIter - rootIter);
 				if (getStringBuffer().size() < newSize) {
 					getStringBuffer().resize(newSize);
 				}
@@ -136,7 +253,6 @@ namespace jsonifier::internal {
 			}
 		}
 
-	  protected:
 		std::vector<error>& getErrors() noexcept {
 			return derivedRef.getErrors();
 		}
@@ -0,0 +1,63 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+#pragma once
+
+#include <jsonifier-incl/simd/simd_types.hpp>
+
+namespace jsonifier::internal {
+
+	inline thread_local constinit uint64_t skippedBytesNew{};
+
+	template<typename value_type, parse_options options> inline thread_local constinit uint64_t skipRatioNew{};
+
+	template<typename value_type, parse_options options> struct read_route {
+		static constexpr uint64_t ratioScale{ 1024 };
+		static constexpr uint64_t minTwoStageLength{ 16384 };
+		static constexpr uint64_t minSkipRatioPrettified{ ratioScale / 2 };
+		static constexpr uint64_t minSkipRatioMinified{ ratioScale - ratioScale / 16 };
+
+		JSONIFIER_INLINE static bool useTwoStage(uint64_t length) noexcept {
+			return length >= minTwoStageLength && skipRatioNew<value_type, options> >= (options.minified ? minSkipRatioMinified : minSkipRatioPrettified);
+		}
+
+		JSONIFIER_INLINE static void begin() noexcept {
+			skippedBytesNew = 0;
+		}
+
+		JSONIFIER_INLINE static void record(uint64_t length) noexcept {
+			if JSONIFIER_LIKELY (length > 0) {
+				const uint64_t ratio			  = (skippedBytesNew > length ? length : skippedBytesNew) * ratioScale / length;
+				skipRatioNew<value_type, options> = (skipRatioNew<value_type, options> * 3 + ratio) / 4;
+			}
+		}
+
+		JSONIFIER_INLINE static uint64_t skipRatio() noexcept {
+			return skipRatioNew<value_type, options>;
+		}
+	};
+
+	JSONIFIER_INLINE void recordSkippedBytes(string_view_ptr start, string_view_ptr end) noexcept {
+		skippedBytesNew += static_cast<uint64_t>(end - start);
+	}
+
+}
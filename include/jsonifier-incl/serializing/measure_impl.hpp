@@ -0,0 +1,274 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// https://github.com/RealTimeChris/jsonifier
+#pragma once
+
+#include <jsonifier-incl/serializing/serialize_impl.hpp>
+
+namespace jsonifier::internal {
+
+	template<typename value_type, serialize_options options> struct measure_impl;
+
+	template<serialize_options options> struct measure {
+		template<typename value_type_new> JSONIFIER_INLINE static uint64_t impl(const value_type_new& value, uint64_t indent) noexcept {
+			return measure_impl<remove_cvref_t<value_type_new>, options>::impl(value, indent);
+		}
+	};
+
+	template<serialize_options options> JSONIFIER_INLINE constexpr uint64_t measureSeparator(uint64_t indent) noexcept {
+		return options.prettify ? 2 + indent : 1;
+	}
+
+	template<serialize_options options> JSONIFIER_INLINE constexpr uint64_t measureOpen(uint64_t indent) noexcept {
+		return options.prettify ? 2 + indent + options.indentSize : 1;
+	}
+
+	template<serialize_options options> JSONIFIER_INLINE constexpr uint64_t measureClose(uint64_t indent) noexcept {
+		return options.prettify ? 2 + indent : 1;
+	}
+
+	template<concepts::jsonifier_object_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		template<uint64_t index> JSONIFIER_INLINE static uint64_t member(const value_type& value, uint64_t indent) noexcept {
+			using json_entity_type = remove_cvref_t<decltype(getBecauseOtherLibAuthorsResolve<index>(core<value_type>::parseValue))>;
+			if constexpr (concepts::has_excluded_keys<value_type>) {
+				auto& keys = value.jsonifierExcludedKeys;
+				if (keys.find(static_cast<typename jsonifier::internal::remove_reference_t<decltype(keys)>::key_type>(json_entity_type::name)) != keys.end()) {
+					return 0;
+				}
+			}
+			static constexpr uint64_t keySize{ json_entity_type::name.size() + (options.prettify ? 4 : 3) };
+			const uint64_t exitSize = json_entity_type::isItLast ? 0 : measureSeparator<options>(indent);
+			return keySize + measure<options>::impl(getMember<json_entity_type::memberPtr>(value), indent) + exitSize;
+		}
+
+		template<uint64_t... indices> JSONIFIER_INLINE static uint64_t members(const value_type& value, uint64_t indent, integer_sequence<indices...>) noexcept {
+			return (member<indices>(value, indent) + ... + 0);
+		}
+
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t indent) noexcept {
+			static constexpr auto memberCount{ coreTupleSize<value_type> };
+			if constexpr (memberCount > 0) {
+				const uint64_t innerIndent = indent + (options.prettify ? options.indentSize : 0);
+				return measureOpen<options>(indent) + members(value, innerIndent, make_integer_sequence<memberCount>{}) + measureClose<options>(indent);
+			} else {
+				return 2;
+			}
+		}
+	};
+
+	template<concepts::map_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t indent) noexcept {
+			const auto newSize = value.size();
+			if JSONIFIER_LIKELY (newSize > 0) {
+				const uint64_t innerIndent = indent + (options.prettify ? options.indentSize : 0);
+				uint64_t length{ measureOpen<options>(indent) + measureClose<options>(indent) + (newSize - 1) * measureSeparator<options>(innerIndent) +
+					newSize * (options.prettify ? 2 : 1) };
+				for (const auto& [key, mapped]: value) {
+					length += measure<options>::impl(key, innerIndent) + measure<options>::impl(mapped, innerIndent);
+				}
+				return length;
+			} else {
+				return 2;
+			}
+		}
+	};
+
+	template<typename value_type, serialize_options options> JSONIFIER_INLINE static uint64_t measureArray(const value_type& value, uint64_t newSize, uint64_t indent) noexcept {
+		if JSONIFIER_LIKELY (newSize > 0) {
+			const uint64_t innerIndent = indent + (options.prettify ? options.indentSize : 0);
+			uint64_t length{ measureOpen<options>(indent) + measureClose<options>(indent) + (newSize - 1) * measureSeparator<options>(innerIndent) };
+			for (const auto& element: value) {
+				length += measure<options>::impl(element, innerIndent);
+			}
+			return length;
+		} else {
+			return 2;
+		}
+	}
+
+	template<concepts::vector_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t indent) noexcept {
+			return measureArray<value_type, options>(value, value.size(), indent);
+		}
+	};
+
+	template<concepts::raw_array_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t indent) noexcept {
+			return measureArray<value_type, options>(value, std::size(value), indent);
+		}
+	};
+
+	template<concepts::tuple_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		static constexpr auto memberCount = tuple_size_v<value_type>;
+
+		template<uint64_t... indices> JSONIFIER_INLINE static uint64_t members(const value_type& value, uint64_t indent, integer_sequence<indices...>) noexcept {
+			return (measure<options>::impl(get<indices>(value), indent) + ... + 0);
+		}
+
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t indent) noexcept {
+			if constexpr (memberCount > 0) {
+				const uint64_t innerIndent = indent + (options.prettify ? options.indentSize : 0);
+				const uint64_t open		   = options.prettify ? 1 + measureOpen<options>(indent) : 1;
+				return open + members(value, innerIndent, make_integer_sequence<memberCount>{}) + (memberCount - 1) * measureSeparator<options>(innerIndent) +
+					measureClose<options>(indent);
+			} else {
+				return 2;
+			}
+		}
+	};
+
+	template<concepts::string_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t) noexcept {
+			return 2 + string_measurer<decltype(value.data())>::impl(value.data(), value.size());
+		}
+	};
+
+	template<concepts::interned_string_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t indent) noexcept {
+			return measure<options>::impl(string_view{ value.data(), value.size() }, indent);
+		}
+	};
+
+	template<concepts::cached_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t indent) noexcept {
+			return value.template isCachedFor<options>(indent) ? value.cacheVal.size() : measure<options>::impl(value.valueVal, indent);
+		}
+	};
+
+	template<concepts::char_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t) noexcept {
+			switch (value) {
+				case '\b':
+				case '\t':
+				case '\n':
+				case '\f':
+				case '\r':
+				case '"':
+				case '\\': {
+					return 4;
+				}
+				default: {
+					return 3;
+				}
+			}
+		}
+	};
+
+	template<concepts::num_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		template<typename integer_type> JSONIFIER_INLINE static uint64_t integerLength(integer_type value) noexcept {
+			if constexpr (concepts::int_types<integer_type>) {
+				const uint64_t magnitude = value < 0 ? uint64_t{ 0 } - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+				return static_cast<uint64_t>(value < 0) + fastDigitCount(magnitude);
+			} else {
+				return fastDigitCount(static_cast<uint64_t>(value));
+			}
+		}
+
+		template<typename float_type> JSONIFIER_INLINE static uint64_t floatLength(float_type value) noexcept {
+			char buffer[64];
+			return static_cast<uint64_t>(to_chars<float_type>::impl(buffer, value) - buffer);
+		}
+
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t) noexcept {
+			if constexpr (concepts::float_t<value_type>) {
+				if constexpr (sizeof(value_type) == 8) {
+					return floatLength(value);
+				} else {
+					return floatLength(static_cast<double>(value));
+				}
+			} else if constexpr (concepts::uint_types<value_type>) {
+				return integerLength(static_cast<uint64_t>(value));
+			} else {
+				return integerLength(static_cast<int64_t>(value));
+			}
+		}
+	};
+
+	template<concepts::enum_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t indent) noexcept {
+			return measure<options>::impl(static_cast<int64_t>(value), indent);
+		}
+	};
+
+	template<concepts::string_enum_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		using enum_data = string_enum_data<value_type>;
+
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t indent) noexcept {
+			if (const uint64_t index = enum_data::indexOf(value); index < enum_data::count) {
+				return string_view{ enum_data::quotedNames[index] }.size();
+			} else {
+				return measure<options>::impl(static_cast<int64_t>(value), indent);
+			}
+		}
+	};
+
+	template<concepts::bool_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t) noexcept {
+			return value ? 4 : 5;
+		}
+	};
+
+	template<concepts::always_null_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type&, uint64_t) noexcept {
+			return 4;
+		}
+	};
+
+	template<concepts::skip_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type&, uint64_t) noexcept {
+			return 4;
+		}
+	};
+
+	template<concepts::raw_json_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t) noexcept {
+			return value.rawJson().size();
+		}
+	};
+
+	template<concepts::json_fragment_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t) noexcept {
+			return value.empty() ? 4 : value.size();
+		}
+	};
+
+	template<typename value_type>
+	concept pointer_like_t = concepts::pointer_t<value_type> || concepts::unique_ptr_t<value_type> || concepts::shared_ptr_t<value_type> || concepts::optional_t<value_type>;
+
+	template<pointer_like_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t indent) noexcept {
+			return value ? measure<options>::impl(*value, indent) : 4;
+		}
+	};
+
+	template<concepts::variant_t value_type, serialize_options options> struct measure_impl<value_type, options> {
+		JSONIFIER_INLINE static uint64_t impl(const value_type& value, uint64_t indent) noexcept {
+			return std::visit(
+				[indent](const auto& element) {
+					return measure<options>::impl(element, indent);
+				},
+				value);
+		}
+	};
+
+}
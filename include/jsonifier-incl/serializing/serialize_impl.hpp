@@ -28,6 +28,9 @@
 #include <jsonifier-incl/parsing/parser.hpp>
 #include <jsonifier-incl/utilities/utility.hpp>
 #include <jsonifier-incl/utilities/json_entity.hpp>
+#include <jsonifier-incl/utilities/string_enum.hpp>
+#include <jsonifier-incl/utilities/cached.hpp>
+#include <jsonifier-incl/utilities/json_fragment.hpp>
 
 namespace jsonifier::internal {
 
@@ -93,8 +96,21 @@ namespace jsonifier::internal {
 			return 2;
 		} else if constexpr (concepts::optional_t<value_type>) {
 			return getPaddingSize<options, typename value_type::value_type>();
-		} else if constexpr (concepts::always_null_t<value_type>) {
+		} else if constexpr (concepts::always_null_t<value_type> || concepts::skip_t<value_type> || concepts::json_fragment_t<value_type>) {
 			return 4;
+		} else if constexpr (concepts::enum_t<value_type>) {
+			return 24;
+		} else if constexpr (concepts::interned_string_t<value_type>) {
+			return 2;
+		} else if constexpr (concepts::cached_t<value_type>) {
+			return getPaddingSize<options, typename value_type::cached_value_type>();
+		} else if constexpr (concepts::variant_t<value_type>) {
+			constexpr auto maxPaddingSizeImpl = []<uint64_t... indices>(jsonifier::internal::integer_sequence<indices...>) noexcept {
+				uint64_t returnValue{};
+				((returnValue = std::max(returnValue, getPaddingSize<options, std::variant_alternative_t<indices, value_type>>())), ...);
+				return returnValue;
+			};
+			return maxPaddingSizeImpl(jsonifier::internal::make_integer_sequence<std::variant_size_v<value_type>>{});
 		} else {
 			return {};
 		}
@@ -143,10 +159,20 @@ namespace jsonifier::internal {
 	}
 
 	template<serialize_options options, typename context_type> JSONIFIER_INLINE static void ensureCapacity(context_type& context, uint64_t additional) noexcept {
-		context.index = static_cast<uint64_t>(context.bufferPtr - context.buffer.data());
-		if (context.buffer.size() <= context.index + additional) {
-			context.buffer.resize((context.index + additional) * 2);
-			context.bufferPtr = context.buffer.data() + context.index;
+		if constexpr (sink_context<context_type>) {
+			context.reserve(additional);
+		} else {
+			context.index = static_cast<uint64_t>(context.bufferPtr - context.buffer.data());
+			if (context.buffer.size() <= context.index + additional) {
+				context.buffer.resize((context.index + additional) * 2);
+				context.bufferPtr = context.buffer.data() + context.index;
+			}
+		}
+	}
+
+	template<serialize_options options, typename context_type> JSONIFIER_INLINE static void ensureElementCapacity(context_type& context, uint64_t paddingSize) noexcept {
+		if constexpr (sink_context<context_type>) {
+			ensureCapacity<options>(context, paddingSize + (options.prettify ? context.indent + options.indentSize + 16 : 8));
 		}
 	}
 
@@ -259,6 +285,63 @@ namespace jsonifier::internal {
 	template<serialize_options options, typename value_type, typename context_type> using serialize_base_t =
 		typename get_serialize_base<options, value_type, context_type, make_integer_sequence<coreTupleSize<value_type>>>::type;
 
+	template<typename value_type>
+	concept fixed_width_t = (concepts::num_t<value_type> || concepts::bool_t<value_type> || concepts::char_t<value_type> || concepts::enum_t<value_type>) &&
+		!concepts::string_enum_t<value_type>;
+
+	template<fixed_width_t value_type> consteval uint64_t maxScalarWidth() noexcept {
+		if constexpr (concepts::bool_t<value_type>) {
+			return 5;
+		} else if constexpr (concepts::char_t<value_type>) {
+			return 4;
+		} else if constexpr (concepts::float_t<value_type>) {
+			return 24;
+		} else if constexpr (concepts::enum_t<value_type>) {
+			return 20;
+		} else if constexpr (concepts::uint_types<value_type>) {
+			return std::numeric_limits<value_type>::digits10 + 1;
+		} else {
+			return std::numeric_limits<value_type>::digits10 + 2;
+		}
+	}
+
+	template<serialize_options options, typename value_type, typename integer_sequence> struct fixed_layout_impl;
+
+	template<serialize_options options, typename value_type, uint64_t... indices> struct fixed_layout_impl<options, value_type, integer_sequence<indices...>> {
+		template<uint64_t index> using entity_type = remove_cvref_t<decltype(getBecauseOtherLibAuthorsResolve<index>(core<value_type>::parseValue))>;
+
+		static constexpr bool eligible{ !options.prettify && sizeof...(indices) > 0 && !concepts::has_excluded_keys<value_type> &&
+			(fixed_width_t<typename entity_type<indices>::member_type> && ...) };
+
+		template<uint64_t index> static constexpr auto prefix{ (index == 0 ? string_literal{ "{\"" } : string_literal{ ",\"" }) + entity_type<index>::name +
+			string_literal{ "\":" } };
+
+		static constexpr uint64_t maxSize{ [] {
+			if constexpr (eligible) {
+				return ((prefix<indices>.size() + maxScalarWidth<typename entity_type<indices>::member_type>()) + ... + 1);
+			} else {
+				return uint64_t{};
+			}
+		}() };
+
+		static constexpr uint64_t capacity{ maxSize + 32 };
+
+		template<uint64_t index, typename context_type> JSONIFIER_INLINE static void writeMember(const value_type& value, context_type& context) noexcept {
+			std::memcpy(context.bufferPtr, prefix<index>.data(), prefix<index>.size());
+			context.bufferPtr += prefix<index>.size();
+			serialize<options>::impl(getMember<entity_type<index>::memberPtr>(value), context);
+		}
+
+		template<typename context_type> JSONIFIER_INLINE static void impl(const value_type& value, context_type& context) noexcept {
+			ensureCapacity<options>(context, capacity);
+			(writeMember<indices>(value, context), ...);
+			*context.bufferPtr = '}';
+			++context.bufferPtr;
+		}
+	};
+
+	template<serialize_options options, typename value_type> struct fixed_layout : public fixed_layout_impl<options, value_type, make_integer_sequence<coreTupleSize<value_type>>> {};
+
 	template<concepts::jsonifier_object_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {
 		using open_indent						 = indent_table<"{\n", options.indentChar, options.indentSize>;
 		using close_indent						 = indent_table<"\n", options.indentChar, options.indentSize>;
@@ -269,7 +352,9 @@ namespace jsonifier::internal {
 			static constexpr auto memberCount{ coreTupleSize<value_type> };
 			static constexpr auto paddingSize{ getPaddingSize<options, value_type>() * 4 };
 
-			if constexpr (memberCount > 0) {
+			if constexpr (fixed_layout<options, value_type>::eligible) {
+				fixed_layout<options, value_type>::impl(value, context);
+			} else if constexpr (memberCount > 0) {
 				if constexpr (options.prettify) {
 					const auto additionalSize = (paddingSize + (memberCount * context.indent * 4));
 					ensureCapacity<options>(context, additionalSize);
@@ -297,6 +382,83 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<serialize_options options> struct parallel_serializer {
+		using comma_indent = indent_table<",\n", options.indentChar, options.indentSize>;
+
+		inline static thread_local bool active{};
+
+		template<typename context_type> JSONIFIER_INLINE static bool enabled(uint64_t newSize) noexcept {
+			if constexpr (options.parallelThreshold > 0 && !sink_context<context_type>) {
+				return newSize >= options.parallelThreshold && !active;
+			} else {
+				return false;
+			}
+		}
+
+		template<typename context_type> JSONIFIER_INLINE static void writeSeparator(context_type& context) noexcept {
+			if constexpr (options.prettify) {
+				comma_indent::blitWithOverflow(context.bufferPtr, context.indent);
+			} else {
+				*context.bufferPtr = ',';
+				++context.bufferPtr;
+			}
+		}
+
+		template<typename iterator_type, typename context_type, typename element_writer>
+		inline static void impl(iterator_type iter, uint64_t newSize, context_type& context, element_writer&& writeElement) noexcept {
+			const uint64_t threadCount = options.parallelThreads > 0 ? options.parallelThreads : std::max<uint64_t>(std::thread::hardware_concurrency(), 1);
+			const uint64_t chunkCount  = std::min(threadCount, newSize);
+			const uint64_t separatorSize{ options.prettify ? context.indent + 16 : 8 };
+			std::vector<std::string> chunkBuffers(chunkCount);
+			std::vector<iterator_type> chunkStarts{};
+			std::vector<uint64_t> chunkSizes(chunkCount);
+			chunkStarts.reserve(chunkCount);
+			for (uint64_t x = 0; x < chunkCount; ++x) {
+				chunkStarts.emplace_back(iter);
+				if (x + 1 < chunkCount) {
+					iter = std::next(iter, static_cast<int64_t>(newSize / chunkCount + (x < newSize % chunkCount)));
+				}
+			}
+			auto serializeChunk = [&](uint64_t chunk) {
+				active					 = true;
+				const uint64_t chunkSize = newSize / chunkCount + (chunk < newSize % chunkCount);
+				serialize_context<std::string> chunkContext{ chunkBuffers[chunk].data(), chunkBuffers[chunk] };
+				chunkContext.indent = context.indent;
+				auto chunkIter		= chunkStarts[chunk];
+				for (uint64_t x = 0; x < chunkSize; ++x, ++chunkIter) {
+					if (x > 0) {
+						ensureCapacity<options>(chunkContext, separatorSize);
+						writeSeparator(chunkContext);
+					}
+					writeElement(chunkIter, chunkContext);
+				}
+				chunkSizes[chunk] = static_cast<uint64_t>(chunkContext.bufferPtr - chunkBuffers[chunk].data());
+				active			  = false;
+			};
+			std::vector<std::thread> threads{};
+			threads.reserve(chunkCount - 1);
+			for (uint64_t x = 1; x < chunkCount; ++x) {
+				threads.emplace_back(serializeChunk, x);
+			}
+			serializeChunk(0);
+			uint64_t totalSize{ separatorSize * chunkCount };
+			for (uint64_t x = 0; x < chunkCount; ++x) {
+				if (x > 0) {
+					threads[x - 1].join();
+				}
+				totalSize += chunkSizes[x];
+			}
+			ensureCapacity<options>(context, totalSize);
+			for (uint64_t x = 0; x < chunkCount; ++x) {
+				if (x > 0) {
+					writeSeparator(context);
+				}
+				std::memcpy(context.bufferPtr, chunkBuffers[x].data(), chunkSizes[x]);
+				context.bufferPtr += chunkSizes[x];
+			}
+		}
+	};
+
 	template<concepts::map_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {		
 		using open_indent						 = indent_table<"{\n", options.indentChar, options.indentSize>;
 		using comma_indent						 = indent_table<",\n", options.indentChar, options.indentSize>;
@@ -309,38 +471,41 @@ namespace jsonifier::internal {
 			const auto newSize = value.size();
 			static constexpr auto paddingSize{ getPaddingSize<options, typename value_type::mapped_type>() };
 
+			static constexpr auto pairPaddingSize{ paddingSize + getPaddingSize<options, typename value_type::key_type>() };
+
 			if JSONIFIER_LIKELY (newSize > 0) {
+				const bool parallel = parallel_serializer<options>::template enabled<context_type>(newSize);
 				if constexpr (options.prettify) {
-					const auto additionalSize = newSize * (paddingSize + context.indent);
+					const auto additionalSize = sink_context<context_type> ? 0 : parallel ? context.indent + options.indentSize + 16 : newSize * (paddingSize + context.indent);
 					ensureCapacity<options>(context, additionalSize);
+					ensureElementCapacity<options>(context, 0);
 					context.indent += options.indentSize;
 					open_indent::blitWithOverflow(context.bufferPtr, context.indent);
 				} else {
-					const auto additionalSize = newSize * paddingSize;
+					const auto additionalSize = sink_context<context_type> ? 0 : parallel ? 8 : newSize * paddingSize;
 					ensureCapacity<options>(context, additionalSize);
+					ensureElementCapacity<options>(context, 0);
 					*context.bufferPtr = '{';
 					++context.bufferPtr;
 				}
 
-				auto iter = value.begin();
-				serialize<options>::impl(iter->first, context);
-				if constexpr (options.prettify) {
-					std::memcpy(context.bufferPtr, &colonSpace.value, colonSpace.lengthToCopy);
-					context.bufferPtr += colonSpace.lengthToAdvance;
+				if (parallel) {
+					parallel_serializer<options>::impl(value.begin(), newSize, context, [](auto& pairIter, auto& chunkContext) {
+						ensureCapacity<options>(chunkContext,
+							computeRuntimeSize<options>(pairIter->first, chunkContext.indent) + computeRuntimeSize<options>(pairIter->second, chunkContext.indent) + 8);
+						serialize<options>::impl(pairIter->first, chunkContext);
+						if constexpr (options.prettify) {
+							std::memcpy(chunkContext.bufferPtr, &colonSpace.value, colonSpace.lengthToCopy);
+							chunkContext.bufferPtr += colonSpace.lengthToAdvance;
+						} else {
+							*chunkContext.bufferPtr = ':';
+							++chunkContext.bufferPtr;
+						}
+						serialize<options>::impl(pairIter->second, chunkContext);
+					});
 				} else {
-					*context.bufferPtr = ':';
-					++context.bufferPtr;
-				}
-				serialize<options>::impl(iter->second, context);
-				++iter;
-				const auto end = value.end();
-				for (; iter != end; ++iter) {
-					if constexpr (options.prettify) {
-						comma_indent::blitWithOverflow(context.bufferPtr, context.indent);
-					} else {
-						*context.bufferPtr = ',';
-						++context.bufferPtr;
-					}
+					auto iter = value.begin();
+					ensureElementCapacity<options>(context, pairPaddingSize);
 					serialize<options>::impl(iter->first, context);
 					if constexpr (options.prettify) {
 						std::memcpy(context.bufferPtr, &colonSpace.value, colonSpace.lengthToCopy);
@@ -350,7 +515,28 @@ namespace jsonifier::internal {
 						++context.bufferPtr;
 					}
 					serialize<options>::impl(iter->second, context);
+					++iter;
+					const auto end = value.end();
+					for (; iter != end; ++iter) {
+						ensureElementCapacity<options>(context, pairPaddingSize);
+						if constexpr (options.prettify) {
+							comma_indent::blitWithOverflow(context.bufferPtr, context.indent);
+						} else {
+							*context.bufferPtr = ',';
+							++context.bufferPtr;
+						}
+						serialize<options>::impl(iter->first, context);
+						if constexpr (options.prettify) {
+							std::memcpy(context.bufferPtr, &colonSpace.value, colonSpace.lengthToCopy);
+							context.bufferPtr += colonSpace.lengthToAdvance;
+						} else {
+							*context.bufferPtr = ':';
+							++context.bufferPtr;
+						}
+						serialize<options>::impl(iter->second, context);
+					}
 				}
+				ensureElementCapacity<options>(context, 0);
 				if constexpr (options.prettify) {
 					context.indent -= options.indentSize;
 					close_indent::blitWithOverflow(context.bufferPtr, context.indent);
@@ -364,6 +550,74 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<serialize_options options> struct numeric_array_serializer {
+		using comma_indent = indent_table<",\n", options.indentChar, options.indentSize>;
+
+		static constexpr uint64_t blockSize{ 32 };
+
+		template<uint64_t digitCount, concepts::batch_numeric_t value_type> JSONIFIER_INLINE static char* writeValue(char* bufferPtr, const value_type value) noexcept {
+			if constexpr (concepts::float_t<value_type>) {
+				return to_chars<double>::impl(bufferPtr, static_cast<double>(value));
+			} else {
+				return to_chars_branchless<value_type>::template impl<digitCount == 0 ? to_chars_branchless<value_type>::maxDigits : digitCount>(bufferPtr, value);
+			}
+		}
+
+		template<uint64_t digitCount, concepts::batch_numeric_t value_type, typename context_type>
+		JSONIFIER_INLINE static void writeBlock(const value_type* iter, const value_type* end, context_type& context) noexcept {
+			char* bufferPtr{ context.bufferPtr };
+			if constexpr (options.prettify) {
+				for (; iter < end; ++iter) {
+					comma_indent::blitWithOverflow(bufferPtr, context.indent);
+					bufferPtr = writeValue<digitCount>(bufferPtr, *iter);
+				}
+			} else {
+				for (; iter < end; ++iter) {
+					*bufferPtr = ',';
+					bufferPtr  = writeValue<digitCount>(bufferPtr + 1, *iter);
+				}
+			}
+			context.bufferPtr = bufferPtr;
+		}
+
+		template<concepts::batch_numeric_t value_type, typename context_type>
+		JSONIFIER_INLINE static void dispatchBlock(const value_type* iter, const value_type* end, context_type& context) noexcept {
+			if constexpr (concepts::float_t<value_type>) {
+				writeBlock<0>(iter, end, context);
+			} else {
+				std::make_unsigned_t<value_type> bits{};
+				for (const value_type* current = iter; current < end; ++current) {
+					if constexpr (concepts::int_types<value_type>) {
+						bits |= to_chars_branchless<value_type>::magnitude(*current);
+					} else {
+						bits |= *current;
+					}
+				}
+				if (bits < (1U << 13)) {
+					writeBlock<4>(iter, end, context);
+				} else if (bits < (1U << 26)) {
+					writeBlock<8>(iter, end, context);
+				} else {
+					writeBlock<0>(iter, end, context);
+				}
+			}
+		}
+
+		template<concepts::batch_numeric_t value_type, typename context_type> JSONIFIER_INLINE static void impl(const value_type* iter, uint64_t newSize, context_type& context) noexcept {
+			static constexpr uint64_t elementSize{ getPaddingSize<options, value_type>() + 1 };
+			const value_type* end{ iter + newSize };
+			ensureElementCapacity<options>(context, elementSize);
+			context.bufferPtr = writeValue<0>(context.bufferPtr, *iter);
+			++iter;
+			while (iter < end) {
+				const value_type* blockEnd{ iter + std::min<uint64_t>(blockSize, static_cast<uint64_t>(end - iter)) };
+				ensureElementCapacity<options>(context, static_cast<uint64_t>(blockEnd - iter) * (elementSize + (options.prettify ? context.indent + 16 : 0)));
+				dispatchBlock(iter, blockEnd, context);
+				iter = blockEnd;
+			}
+		}
+	};
+
 	template<concepts::vector_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {		
 		using open_indent						 = indent_table<"[\n", options.indentChar, options.indentSize>;
 		using comma_indent						 = indent_table<",\n", options.indentChar, options.indentSize>;
@@ -374,8 +628,14 @@ namespace jsonifier::internal {
 		template<typename value_type_new> inline static void impl(value_type_new&& value, context_type& context) noexcept {
 			const auto newSize = value.size();
 			if JSONIFIER_LIKELY (newSize > 0) {
-				const auto additional = computeRuntimeSize<options>(value, context.indent);
-				ensureCapacity<options>(context, additional);
+				static constexpr auto paddingSize{ getPaddingSize<options, typename value_type::value_type>() };
+				const bool parallel = parallel_serializer<options>::template enabled<context_type>(newSize);
+				if constexpr (sink_context<context_type>) {
+					ensureElementCapacity<options>(context, 0);
+				} else {
+					const auto additional = parallel ? context.indent + options.indentSize + 16 : computeRuntimeSize<options>(value, context.indent);
+					ensureCapacity<options>(context, additional);
+				}
 
 				if constexpr (options.prettify) {
 					context.indent += options.indentSize;
@@ -386,17 +646,29 @@ namespace jsonifier::internal {
 				}
 
 				auto iter = getBeginIterVec(value);
-				serialize<options>::impl(iter[0], context);
-				for (uint64_t index{ 1 }; index != newSize; ++index) {
-					if constexpr (options.prettify) {
-						comma_indent::blitWithOverflow(context.bufferPtr, context.indent);
-					} else {
-						*context.bufferPtr = ',';
-						++context.bufferPtr;
+				if (parallel) {
+					parallel_serializer<options>::impl(iter, newSize, context, [](auto& elementIter, auto& chunkContext) {
+						ensureCapacity<options>(chunkContext, computeRuntimeSize<options>(*elementIter, chunkContext.indent));
+						serialize<options>::impl(*elementIter, chunkContext);
+					});
+				} else if constexpr (concepts::batch_numeric_t<typename value_type::value_type>) {
+					numeric_array_serializer<options>::impl(value.data(), newSize, context);
+				} else {
+					ensureElementCapacity<options>(context, paddingSize);
+					serialize<options>::impl(iter[0], context);
+					for (uint64_t index{ 1 }; index != newSize; ++index) {
+						ensureElementCapacity<options>(context, paddingSize);
+						if constexpr (options.prettify) {
+							comma_indent::blitWithOverflow(context.bufferPtr, context.indent);
+						} else {
+							*context.bufferPtr = ',';
+							++context.bufferPtr;
+						}
+						serialize<options>::impl(iter[static_cast<int64_t>(index)], context);
 					}
-					serialize<options>::impl(iter[static_cast<int64_t>(index)], context);
 				}
 
+				ensureElementCapacity<options>(context, 0);
 				if constexpr (options.prettify) {
 					context.indent -= options.indentSize;
 					close_indent::blitWithOverflow(context.bufferPtr, context.indent);
@@ -423,21 +695,25 @@ namespace jsonifier::internal {
 			static constexpr auto paddingSize{ getPaddingSize<options, typename value_type_new<value_type_internal, size>::value_type>() };
 			if constexpr (newSize > 0) {
 				if constexpr (options.prettify) {
-					const auto additionalSize = newSize * (paddingSize + context.indent);
+					const auto additionalSize = sink_context<context_type> ? 0 : newSize * (paddingSize + context.indent);
 					ensureCapacity<options>(context, additionalSize);
+					ensureElementCapacity<options>(context, 0);
 					context.indent += options.indentSize;
 					open_indent::blitWithOverflow(context.bufferPtr, context.indent);
 				} else {
-					const auto additionalSize = newSize * paddingSize;
+					const auto additionalSize = sink_context<context_type> ? 0 : newSize * paddingSize;
 					ensureCapacity<options>(context, additionalSize);
+					ensureElementCapacity<options>(context, 0);
 					*context.bufferPtr = '[';
 					++context.bufferPtr;
 				}
 
 				auto iter = getBeginIterVec(value);
+				ensureElementCapacity<options>(context, paddingSize);
 				serialize<options>::impl(iter[0], context);
 				if constexpr (newSize > 1) {
 					for (uint64_t index{ 1 }; index != newSize; ++index) {
+						ensureElementCapacity<options>(context, paddingSize);
 						if constexpr (options.prettify) {
 							comma_indent::blitWithOverflow(context.bufferPtr, context.indent);
 						} else {
@@ -448,6 +724,7 @@ namespace jsonifier::internal {
 					}
 				}
 
+				ensureElementCapacity<options>(context, 0);
 				if constexpr (options.prettify) {
 					context.indent -= options.indentSize;
 					close_indent::blitWithOverflow(context.bufferPtr, context.indent);
@@ -530,6 +807,37 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<concepts::interned_string_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {
+		template<typename value_type_new> JSONIFIER_INLINE static void impl(value_type_new&& value, context_type& context) noexcept {
+			serialize<options>::impl(string_view{ value.data(), value.size() }, context);
+		}
+	};
+
+	template<concepts::cached_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {
+		template<typename value_type_new> JSONIFIER_INLINE static void impl(value_type_new&& value, context_type& context) noexcept {
+			if (!value.template isCachedFor<options>(context.indent)) {
+				if constexpr (sink_context<context_type>) {
+					serialize_context<std::string> cacheContext{ value.cacheVal.data(), value.cacheVal };
+					cacheContext.indent = context.indent;
+					ensureCapacity<options>(cacheContext, getPaddingSize<options, typename value_type::cached_value_type>());
+					serialize<options>::impl(value.valueVal, cacheContext);
+					value.cacheVal.resize(static_cast<uint64_t>(cacheContext.bufferPtr - value.cacheVal.data()));
+					value.template markCached<options>(context.indent);
+				} else {
+					const auto start = static_cast<uint64_t>(context.bufferPtr - context.buffer.data());
+					serialize<options>::impl(value.valueVal, context);
+					value.cacheVal.assign(context.buffer.data() + start, context.bufferPtr);
+					value.template markCached<options>(context.indent);
+					return;
+				}
+			}
+			const auto size = value.cacheVal.size();
+			ensureCapacity<options>(context, size);
+			std::memcpy(context.bufferPtr, value.cacheVal.data(), size);
+			context.bufferPtr += size;
+		}
+	};
+
 	template<concepts::char_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {
 		template<typename value_type_new> JSONIFIER_INLINE static void impl(value_type_new&& value, context_type& context) noexcept {
 			*context.bufferPtr = '"';
@@ -587,6 +895,22 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<concepts::string_enum_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {
+		using enum_data = string_enum_data<remove_cvref_t<value_type>>;
+
+		template<typename value_type_new> JSONIFIER_INLINE static void impl(value_type_new&& value, context_type& context) noexcept {
+			if (const uint64_t index = enum_data::indexOf(value); index < enum_data::count) {
+				const string_view name{ enum_data::quotedNames[index] };
+				ensureCapacity<options>(context, name.size());
+				std::memcpy(context.bufferPtr, name.data(), name.size());
+				context.bufferPtr += name.size();
+			} else {
+				int64_t valueNew{ static_cast<int64_t>(value) };
+				serialize<options>::impl(valueNew, context);
+			}
+		}
+	};
+
 	template<concepts::num_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {
 		template<typename value_type_new> JSONIFIER_INLINE static void impl(value_type_new&& value, context_type& context) noexcept {
 			if constexpr (sizeof(value_type) == 8) {
@@ -655,6 +979,23 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<concepts::json_fragment_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {
+		template<typename value_type_new> JSONIFIER_INLINE static void impl(value_type_new&& value, context_type& context) noexcept {
+			const auto size = value.size();
+			if JSONIFIER_UNLIKELY (size == 0) {
+				JSONIFIER_ALIGN(4) static constexpr char_blitter<"null"> nullV{};
+				std::memcpy(context.bufferPtr, &nullV.value, nullV.lengthToCopy);
+				context.bufferPtr += nullV.lengthToAdvance;
+			} else if constexpr (external_context<context_type>) {
+				context.external(value.data(), size);
+			} else {
+				ensureCapacity<options>(context, size);
+				std::memcpy(context.bufferPtr, value.data(), size);
+				context.bufferPtr += size;
+			}
+		}
+	};
+
 	template<concepts::skip_t value_type, typename context_type, serialize_options options> struct serialize_impl<value_type, context_type, options> {
 		template<typename value_type_new> JSONIFIER_INLINE static void impl(value_type_new&&, context_type& context) noexcept {
 			JSONIFIER_ALIGN(4) static constexpr char_blitter<"null"> nullV{};
@@ -708,3 +1049,17 @@ namespace jsonifier::internal {
 		}
 	};
 }
+
+namespace jsonifier {
+
+	template<typename value_type, serialize_options options = serialize_options{}> inline constexpr uint64_t maxSerializedSize{ [] {
+		static_assert(internal::fixed_layout<options, value_type>::eligible, "maxSerializedSize requires a minified, registered struct whose members are all fixed-width scalars.");
+		return internal::fixed_layout<options, value_type>::maxSize;
+	}() };
+
+	template<typename value_type, serialize_options options = serialize_options{}> inline constexpr uint64_t fixedLayoutCapacity{ [] {
+		static_assert(internal::fixed_layout<options, value_type>::eligible, "fixedLayoutCapacity requires a minified, registered struct whose members are all fixed-width scalars.");
+		return internal::fixed_layout<options, value_type>::capacity;
+	}() };
+
+}
@@ -23,6 +23,7 @@
 /// Feb 20, 2023
 #pragma once
 
+#include <jsonifier-incl/containers/segmented_buffer.hpp>
 #include <jsonifier-incl/utilities/number_utils.hpp>
 #include <jsonifier-incl/utilities/string_utils.hpp>
 #include <jsonifier-incl/serializing/prettifier.hpp>
@@ -32,6 +33,14 @@ namespace jsonifier::internal {
 
 	template<typename value_type, typename context_type, serialize_options optionsNew> struct serialize_impl;
 
+	template<serialize_options options, typename value_type> static constexpr uint64_t getPaddingSize() noexcept;
+
+	template<serialize_options options, typename context_type> JSONIFIER_INLINE static void ensureCapacity(context_type& context, uint64_t additional) noexcept;
+
+	template<serialize_options options> struct measure;
+
+	template<serialize_options options, typename value_type> struct fixed_layout;
+
 	template<serialize_options options> struct serialize {
 		template<typename value_type_new, typename context_type> inline static void impl(value_type_new&& value, context_type&& context) noexcept {
 			using value_type = remove_cvref_t<value_type_new>;
@@ -63,6 +72,97 @@ namespace jsonifier::internal {
 		uint64_t index{};
 	};
 
+	template<typename buffer_type, typename sink_type> struct serialize_sink_context {
+		inline serialize_sink_context(buffer_type& bufferNew, sink_type& sinkNew, uint64_t chunkSizeNew) noexcept
+			: bufferPtr{ bufferNew.data() }, buffer{ bufferNew }, sink{ sinkNew }, chunkSize{ chunkSizeNew } {
+		}
+
+		inline void flush() noexcept {
+			const auto length = static_cast<uint64_t>(bufferPtr - buffer.data());
+			if (length > 0) {
+				sink(static_cast<const char*>(buffer.data()), length);
+				bufferPtr = buffer.data();
+			}
+		}
+
+		inline void reserve(uint64_t additional) noexcept {
+			index = static_cast<uint64_t>(bufferPtr - buffer.data());
+			if (index + additional >= chunkSize) {
+				flush();
+				index = 0;
+			}
+			if JSONIFIER_UNLIKELY (buffer.size() <= additional) {
+				buffer.resize(additional * 2);
+				bufferPtr = buffer.data();
+			}
+		}
+
+		string_buffer_ptr bufferPtr{};
+		buffer_type& buffer;
+		sink_type& sink;
+		uint64_t chunkSize{};
+		uint64_t indent{};
+		uint64_t index{};
+	};
+
+	template<typename buffer_type> struct serialize_segment_context {
+		inline serialize_segment_context(buffer_type& bufferNew) noexcept : bufferPtr{ bufferNew.begin() }, buffer{ bufferNew } {
+		}
+
+		inline void flush() noexcept {
+			buffer.seal(bufferPtr);
+		}
+
+		inline void reserve(uint64_t additional) noexcept {
+			if (buffer.remaining(bufferPtr) <= additional) {
+				bufferPtr = buffer.advance(bufferPtr, additional);
+			}
+		}
+
+		inline void external(string_view_ptr data, uint64_t size) noexcept {
+			if (size < externalThreshold) {
+				reserve(size);
+				std::memcpy(bufferPtr, data, size);
+				bufferPtr += size;
+			} else {
+				buffer.external(bufferPtr, data, size);
+			}
+		}
+
+		static constexpr uint64_t externalThreshold{ 1024 };
+
+		string_buffer_ptr bufferPtr{};
+		buffer_type& buffer;
+		uint64_t indent{};
+		uint64_t index{};
+	};
+
+	struct serialize_exact_context {
+		inline serialize_exact_context(string_buffer_ptr ptrNew) noexcept : bufferPtr{ ptrNew } {
+		}
+
+		inline void flush() noexcept {
+		}
+
+		inline void reserve(uint64_t) noexcept {
+		}
+
+		string_buffer_ptr bufferPtr{};
+		uint64_t indent{};
+		uint64_t index{};
+	};
+
+	static constexpr uint64_t exactSizePadding{ 64 };
+
+	template<typename context_type>
+	concept sink_context = requires(context_type context) { context.flush(); };
+
+	template<typename context_type>
+	concept external_context = requires(context_type context, string_view_ptr data) { context.external(data, uint64_t{}); };
+
+	template<typename value_type>
+	concept serialize_sink = std::invocable<value_type&, const char*, uint64_t>;
+
 	template<typename derived_type> class serializer {
 	  public:
 		serializer& operator=(const serializer& other) = delete;
@@ -71,14 +171,71 @@ namespace jsonifier::internal {
 		template<serialize_options optionsNew = serialize_options{}, typename value_type, concepts::buffer_like buffer_type>
 		inline bool serializeJson(value_type&& object, buffer_type&& buffer) noexcept {
 			static constexpr serialize_options options{ optionsNew };
-			serialize_context<decltype(derivedRef.stringBuffer)> context{ derivedRef.stringBuffer.data(), derivedRef.stringBuffer };
+			serialize_context<remove_cvref_t<buffer_type>> context{ buffer.data(), buffer };
+			ensureCapacity<options>(context, getPaddingSize<options, remove_cvref_t<value_type>>());
 			serialize<options>::impl(object, context);
 			context.index = static_cast<uint64_t>(context.bufferPtr - context.buffer.data());
 			buffer.resize(context.index);
-			std::copy(derivedRef.stringBuffer.data(), derivedRef.stringBuffer.data() + context.index, buffer.data());
 			return true;
 		}
 
+		template<serialize_options optionsNew = serialize_options{}, typename value_type, concepts::buffer_like buffer_type>
+		inline bool serializeJson(value_type&& object, buffer_type&& buffer, uint64_t exactSize) noexcept {
+			static constexpr serialize_options options{ optionsNew };
+			buffer.resize(exactSize + exactSizePadding);
+			serialize_exact_context context{ buffer.data() };
+			serialize<options>::impl(object, context);
+			context.index = static_cast<uint64_t>(context.bufferPtr - buffer.data());
+			buffer.resize(exactSize);
+			return context.index == exactSize;
+		}
+
+		template<serialize_options optionsNew = serialize_options{}, typename value_type, uint64_t size>
+		inline string_view serializeJson(const value_type& object, std::array<char, size>& buffer) noexcept {
+			static constexpr serialize_options options{ optionsNew };
+			static_assert(fixed_layout<options, value_type>::eligible, "Serializing into a std::array requires a minified, registered struct whose members are all fixed-width scalars.");
+			static_assert(size >= fixed_layout<options, value_type>::capacity, "The std::array must hold at least jsonifier::fixedLayoutCapacity<value_type> bytes.");
+			serialize_exact_context context{ buffer.data() };
+			serialize<options>::impl(object, context);
+			return string_view{ buffer.data(), static_cast<uint64_t>(context.bufferPtr - buffer.data()) };
+		}
+
+		template<serialize_options optionsNew = serialize_options{}, typename value_type> inline uint64_t measureJson(const value_type& object) noexcept {
+			static constexpr serialize_options options{ optionsNew };
+			return measure<options>::impl(object, 0);
+		}
+
+		template<serialize_options optionsNew = serialize_options{}, typename value_type, serialize_sink sink_type>
+		inline bool serializeJson(value_type&& object, sink_type&& sink) noexcept {
+			static constexpr serialize_options options{ optionsNew };
+			if (derivedRef.stringBuffer.size() < options.chunkSize * 2) {
+				derivedRef.stringBuffer.resize(options.chunkSize * 2);
+			}
+			serialize_sink_context<decltype(derivedRef.stringBuffer), remove_reference_t<sink_type>> context{ derivedRef.stringBuffer, sink, options.chunkSize };
+			ensureCapacity<options>(context, getPaddingSize<options, remove_cvref_t<value_type>>());
+			serialize<options>::impl(object, context);
+			context.flush();
+			return true;
+		}
+
+		template<serialize_options optionsNew = serialize_options{}, typename value_type, uint64_t segmentSize>
+		inline bool serializeJson(value_type&& object, segmented_buffer<segmentSize>& buffer) noexcept {
+			static constexpr serialize_options options{ optionsNew };
+			serialize_segment_context<segmented_buffer<segmentSize>> context{ buffer };
+			ensureCapacity<options>(context, getPaddingSize<options, remove_cvref_t<value_type>>());
+			serialize<options>::impl(object, context);
+			context.flush();
+			return true;
+		}
+
+		template<serialize_options optionsNew = serialize_options{}, typename value_type> inline bool serializeJson(value_type&& object, std::ostream& stream) noexcept {
+			auto sink = [&stream](const char* data, uint64_t length) {
+				stream.write(data, static_cast<std::streamsize>(length));
+			};
+			serializeJson<optionsNew>(object, sink);
+			return stream.good();
+		}
+
 		template<serialize_options optionsNew = serialize_options{}, typename value_type> inline string_view serializeJson(const value_type& object) noexcept {
 			static constexpr serialize_options options{ optionsNew };
 			serialize_context<decltype(derivedRef.stringBuffer)> context{ derivedRef.stringBuffer.data(), derivedRef.stringBuffer };
@@ -0,0 +1,111 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// https://github.com/RealTimeChris/jsonifier
+
+#pragma once
+
+#include <jsonifier-incl/utilities/utility.hpp>
+#include <string>
+
+namespace jsonifier::internal {
+
+	template<typename value_type, typename context_type, serialize_options optionsNew> struct serialize_impl;
+
+	template<typename value_type, typename context_type, parse_options options> struct parse_impl;
+
+	template<typename value_type, serialize_options options> struct measure_impl;
+
+	template<serialize_options options> inline constexpr char cacheKey{};
+
+}
+
+namespace jsonifier {
+
+	template<typename value_type_new> class cached {
+	  public:
+		template<typename value_type, typename context_type, serialize_options optionsNew> friend struct internal::serialize_impl;
+		template<typename value_type, typename context_type, parse_options options> friend struct internal::parse_impl;
+		template<typename value_type, serialize_options options> friend struct internal::measure_impl;
+
+		using cached_value_type = value_type_new;
+
+		JSONIFIER_INLINE cached() noexcept = default;
+
+		JSONIFIER_INLINE cached(const cached_value_type& valueNew) : valueVal{ valueNew } {
+		}
+
+		JSONIFIER_INLINE cached(cached_value_type&& valueNew) noexcept : valueVal{ internal::move(valueNew) } {
+		}
+
+		JSONIFIER_INLINE cached& operator=(const cached_value_type& valueNew) {
+			valueVal = valueNew;
+			markDirty();
+			return *this;
+		}
+
+		JSONIFIER_INLINE cached& operator=(cached_value_type&& valueNew) noexcept {
+			valueVal = internal::move(valueNew);
+			markDirty();
+			return *this;
+		}
+
+		JSONIFIER_INLINE const cached_value_type& operator*() const noexcept {
+			return valueVal;
+		}
+
+		JSONIFIER_INLINE const cached_value_type* operator->() const noexcept {
+			return &valueVal;
+		}
+
+		JSONIFIER_INLINE cached_value_type& mutate() noexcept {
+			markDirty();
+			return valueVal;
+		}
+
+		JSONIFIER_INLINE void markDirty() noexcept {
+			dirty = true;
+		}
+
+		JSONIFIER_INLINE bool isDirty() const noexcept {
+			return dirty;
+		}
+
+	  protected:
+		cached_value_type valueVal{};
+		mutable std::string cacheVal{};
+		mutable const char* cacheKey{};
+		mutable uint64_t cacheIndent{};
+		mutable bool dirty{ true };
+
+		template<serialize_options options> JSONIFIER_INLINE bool isCachedFor(uint64_t indent) const noexcept {
+			return !dirty && cacheKey == &internal::cacheKey<options> && cacheIndent == indent;
+		}
+
+		template<serialize_options options> JSONIFIER_INLINE void markCached(uint64_t indent) const noexcept {
+			cacheKey	= &internal::cacheKey<options>;
+			cacheIndent = indent;
+			dirty		= false;
+		}
+	};
+
+}
@@ -46,6 +46,10 @@ namespace jsonifier {
 
 	class raw_json_data;
 
+	class interned_string;
+
+	class json_fragment;
+
 	// Idea for this interface sampled from Stephen Berry and his library, Glaze library: https://github.com/stephenberry/glaze
 	template<typename value_type> struct core;
 
@@ -197,6 +201,10 @@ namespace jsonifier::concepts {
 	template<typename value_type>
 	concept num_t = (float_t<value_type> || uint_types<value_type> || int_types<value_type>) && !char_t<value_type>;
 
+	template<typename value_type>
+	concept batch_numeric_t = std::same_as<value_type, double> || std::same_as<value_type, float> || std::same_as<value_type, int64_t> || std::same_as<value_type, uint64_t> ||
+		std::same_as<value_type, int32_t>;
+
 	template<typename value_type>
 	concept has_substr = requires(jsonifier::internal::remove_cvref_t<value_type> value) {
 		{
@@ -225,6 +233,11 @@ namespace jsonifier::concepts {
 	template<typename value_type>
 	concept map_t = map_subscriptable<value_type> && has_range<value_type> && has_size<value_type> && has_find<value_type> && has_empty<value_type>;
 
+	template<typename value_type>
+	concept key_view_emplaceable = requires(jsonifier::internal::remove_cvref_t<value_type> value, const std::string_view& key) {
+		{ value.try_emplace(key).first->second } -> std::same_as<typename jsonifier::internal::remove_cvref_t<value_type>::mapped_type&>;
+	};
+
 	template<typename value_type>
 	concept pair_t = requires(jsonifier::internal::remove_cvref_t<value_type> value) {
 		typename jsonifier::internal::remove_cvref_t<value_type>::first_type;
@@ -282,6 +295,18 @@ namespace jsonifier::concepts {
 	template<typename value_type>
 	concept raw_json_t = std::same_as<jsonifier::internal::remove_cvref_t<value_type>, raw_json_data>;
 
+	template<typename value_type>
+	concept interned_string_t = std::same_as<jsonifier::internal::remove_cvref_t<value_type>, interned_string>;
+
+	template<typename value_type>
+	concept json_fragment_t = std::same_as<jsonifier::internal::remove_cvref_t<value_type>, json_fragment>;
+
+	template<typename value_type>
+	concept cached_t = requires(jsonifier::internal::remove_cvref_t<value_type> value) {
+		typename jsonifier::internal::remove_cvref_t<value_type>::cached_value_type;
+		value.markDirty();
+	};
+
 	template<typename value_type01, typename value_type02>
 	concept same_character_size = requires {
 		sizeof(typename jsonifier::internal::remove_cvref_t<value_type01>::value_type) == sizeof(typename jsonifier::internal::remove_cvref_t<value_type02>::value_type);
@@ -313,12 +338,21 @@ namespace jsonifier::concepts {
 	template<typename value_type>
 	concept enum_t = std::is_enum_v<jsonifier::internal::remove_cvref_t<value_type>>;
 
+	template<typename value_type>
+	concept string_enum_t = enum_t<value_type> && requires { core<jsonifier::internal::remove_cvref_t<value_type>>::enumValue; };
+
 	template<typename value_type>
 	concept vector_t = vector_subscriptable<value_type> && has_resize<value_type> && has_emplace_back<value_type>;
 
 	template<typename value_type>
 	concept jsonifier_object_t = requires { core<jsonifier::internal::remove_cvref_t<value_type>>::parseValue; };
 
+	template<typename value_type>
+	concept tagged_variant_t = variant_t<value_type> && requires {
+		core<jsonifier::internal::remove_cvref_t<value_type>>::tagKey;
+		core<jsonifier::internal::remove_cvref_t<value_type>>::variantTags;
+	};
+
 	template<typename value_type>
 	concept raw_array_t = ( std::is_array_v<jsonifier::internal::remove_cvref_t<value_type>> && !std::is_pointer_v<jsonifier::internal::remove_cvref_t<value_type>> ) ||
 		(vector_subscriptable<value_type> && !vector_t<value_type> && !has_substr<value_type> && !tuple_t<value_type>);
@@ -58,6 +58,8 @@ namespace jsonifier::internal {
 		exceeded_max_depth,
 		unexpected_token,
 		illegal_control_character,
+		invalid_enum_value,
+		invalid_variant_tag,
 		count,
 	};
 
@@ -197,33 +199,71 @@ namespace jsonifier::internal {
 	  public:
 		template<parse_options parseOpts, typename iterator_type, typename string_buffer_type> friend struct json_iterator;
 
+		static constexpr uint64_t snippetCapacity{ 16 };
+
 		error() noexcept = default;
 
-		error(std::source_location sourceLocation, status_classes errorClassNew, string_view_ptr rootIter, string_view_ptr errorPos, string_view_ptr endIter,
-			uint64_t typeNew) noexcept {
-			errorType			= typeNew;
-			errorClass			= errorClassNew;
-			uint64_t errorIndex = static_cast<uint64_t>(errorPos - rootIter);
+		error(std::source_location sourceLocationNew, status_classes errorClassNew, string_view_ptr rootIter, string_view_ptr errorPos, string_view_ptr endIter,
+			uint64_t typeNew) noexcept
+			: sourceLocation{ sourceLocationNew }, errorType{ typeNew }, errorIndex{ static_cast<uint64_t>(errorPos - rootIter) }, errorClass{ errorClassNew } {
+			if (errorPos && endIter && errorPos < endIter) {
+				snippetLength = static_cast<uint8_t>(std::min(snippetCapacity, static_cast<uint64_t>(endIter - errorPos)));
+				std::memcpy(snippet.data(), errorPos, snippetLength);
+			}
+		}
+
+		template<status_classes errorClassNew> static error constructError(auto typeNew, string_view_ptr rootIter, string_view_ptr errorPos, string_view_ptr endIter,
+			const std::source_location& sourceLocation = std::source_location::current()) noexcept {
+			return { sourceLocation, errorClassNew, rootIter, errorPos, endIter, static_cast<uint64_t>(typeNew) };
+		}
+
+		template<status_classes errorClassNew, auto typeNew> static error constructError(string_view_ptr rootIter, string_view_ptr errorPos, string_view_ptr endIter,
+			const std::source_location& sourceLocation = std::source_location::current()) noexcept {
+			return { sourceLocation, errorClassNew, rootIter, errorPos, endIter, static_cast<uint64_t>(typeNew) };
+		}
+
+		template<typename error_class> operator error_class() const noexcept {
+			return static_cast<error_class>(errorType);
+		}
+
+		operator bool() const noexcept {
+			return errorType != 0;
+		}
+
+		bool operator==(const error& rhs) const noexcept {
+			return errorType == rhs.errorType && errorClass == rhs.errorClass && errorIndex == rhs.errorIndex;
+		}
+
+		status_classes getErrorClass() const noexcept {
+			return errorClass;
+		}
+
+		uint64_t getErrorIndex() const noexcept {
+			return errorIndex;
+		}
+
+		const std::source_location& getSourceLocation() const noexcept {
+			return sourceLocation;
+		}
 
+		string reportError() const {
 			uint64_t line{ 0 };
 			uint64_t localIndex{ 0 };
 			string context{};
 
-			if (errorPos && endIter && errorPos < endIter) {
-				uint64_t errorLength = std::min(static_cast<uint64_t>(16ULL), static_cast<uint64_t>(endIter - errorPos));
-				int64_t reportIndex	 = static_cast<int64_t>(errorIndex);
-				if (static_cast<uint64_t>(reportIndex) >= errorLength) {
-					reportIndex = static_cast<int64_t>(errorLength) - 1;
+			if (snippetLength > 0) {
+				int64_t reportIndex = static_cast<int64_t>(errorIndex);
+				if (static_cast<uint64_t>(reportIndex) >= snippetLength) {
+					reportIndex = static_cast<int64_t>(snippetLength) - 1;
 				}
-				string_view view{ errorPos, errorLength };
+				string_view view{ snippet.data(), snippetLength };
 				using V				   = std::decay_t<decltype(view[0])>;
 				const auto start	   = std::begin(view) + reportIndex;
 				line				   = uint64_t(std::count(std::begin(view), start, static_cast<V>('\n')) + 1);
 				const auto rstart	   = std::rbegin(view) + static_cast<int64_t>(view.size()) - reportIndex - 1ll;
 				const auto prevNewLine = std::find((std::min)(rstart + 1, std::rend(view)), std::rend(view), static_cast<V>('\n'));
 				localIndex			   = static_cast<uint64_t>(std::distance(rstart, prevNewLine) - 1ll);
-				auto endIndex{ std::end(view) - start >= 64 ? 64 : std::end(view) - start };
-				context = string{ start, static_cast<uint64_t>(endIndex) };
+				context				   = string{ start, static_cast<uint64_t>(std::end(view) - start) };
 				for (auto& c: context) {
 					if (c == '\t') {
 						c = ' ';
@@ -239,39 +279,16 @@ namespace jsonifier::internal {
 			}
 			stream << string{ "\nIn file: " } << sourceLocation.file_name() << ", at: " << std::to_string(sourceLocation.line()) << ":" << std::to_string(sourceLocation.column())
 				   << ", in function: " << sourceLocation.function_name() << "().\n";
-			finalMessage = stream.str();
-		}
-
-		template<status_classes errorClassNew> static error constructError(auto typeNew, string_view_ptr rootIter, string_view_ptr errorPos, string_view_ptr endIter,
-			const std::source_location& sourceLocation = std::source_location::current()) noexcept {
-			return { sourceLocation, errorClassNew, rootIter, errorPos, endIter, static_cast<uint64_t>(typeNew) };
-		}
-
-		template<status_classes errorClassNew, auto typeNew> static error constructError(string_view_ptr rootIter, string_view_ptr errorPos, string_view_ptr endIter,
-			const std::source_location& sourceLocation = std::source_location::current()) noexcept {
-			return { sourceLocation, errorClassNew, rootIter, errorPos, endIter, static_cast<uint64_t>(typeNew) };
-		}
-
-		template<typename error_class> operator error_class() const noexcept {
-			return static_cast<error_class>(errorType);
-		}
-
-		operator bool() const noexcept {
-			return errorType != 0;
-		}
-
-		bool operator==(const error& rhs) const noexcept {
-			return errorType == rhs.errorType && errorClass == rhs.errorClass && finalMessage == rhs.finalMessage;
-		}
-
-		const string& reportError() const noexcept {
-			return finalMessage;
+			return stream.str();
 		}
 
 	  protected:
-		status_classes errorClass{};
-		string finalMessage{};
+		std::source_location sourceLocation{};
 		uint64_t errorType{};
+		uint64_t errorIndex{};
+		status_classes errorClass{};
+		uint8_t snippetLength{};
+		array<char, snippetCapacity> snippet{};
 
 		static string collectValues(const string& inputValues) {
 			string output{};
@@ -282,6 +299,8 @@ namespace jsonifier::internal {
 		}
 	};
 
+	static_assert(std::is_trivially_copyable_v<error>, "Error records must stay trivially copyable so that rejecting never allocates.");
+
 	inline static std::ostream& operator<<(std::ostream& os, const error& errorNew) noexcept {
 		os << errorNew.reportError();
 		return os;
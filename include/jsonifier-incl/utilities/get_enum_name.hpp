@@ -26,7 +26,7 @@
 
 namespace jsonifier::internal {
 
-	template<concepts::printable_enum_types auto current_index> JSONIFIER_INLINE consteval string_view getEnumName() {
+	template<concepts::enum_t auto current_index> JSONIFIER_INLINE consteval string_view getEnumName() {
 		string_view str = std::source_location::current().function_name();
 #if JSONIFIER_COMPILER_GCC
 		str			   = str.substr(str.find("=") + 2);
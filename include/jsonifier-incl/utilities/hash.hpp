@@ -172,4 +172,37 @@ namespace jsonifier::internal {
 			return seed64 ^ (seed64 >> 32);
 		}
 	};
+
+	struct rt_seeded_key_hasher {
+		uint64_t seed{};
+
+		JSONIFIER_INLINE uint64_t hashKeyRt(string_view_ptr value, uint64_t length) const noexcept {
+			uint64_t seed64{ seed };
+			uint64_t chunk64{};
+			uint32_t chunk32{};
+			uint16_t chunk16{};
+			while (length >= 8) {
+				std::memcpy(&chunk64, value, 8);
+				seed64 = (seed64 ^ chunk64) * 0x9E3779B185EBCA87ull;
+				value += 8;
+				length -= 8;
+			}
+			if (length >= 4) {
+				std::memcpy(&chunk32, value, 4);
+				seed64 = (seed64 ^ chunk32) * 0x9E3779B185EBCA87ull;
+				value += 4;
+				length -= 4;
+			}
+			if (length >= 2) {
+				std::memcpy(&chunk16, value, 2);
+				seed64 = (seed64 ^ chunk16) * 0x9E3779B185EBCA87ull;
+				value += 2;
+				length -= 2;
+			}
+			if (length == 1) {
+				seed64 = (seed64 ^ static_cast<uint8_t>(*value)) * 0x9E3779B185EBCA87ull;
+			}
+			return seed64 ^ (seed64 >> 32);
+		}
+	};
 }
@@ -453,4 +453,63 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<typename v_type> struct to_chars_branchless;
+
+	template<concepts::uint_types v_type> struct to_chars_branchless<v_type> {
+		static constexpr uint64_t maxDigits{ sizeof(v_type) == 8 ? 20 : 12 };
+
+		template<uint64_t digitCount> JSONIFIER_INLINE static void writeDigits(char* __restrict digits, const uint64_t value) noexcept {
+			if constexpr (digitCount == 4) {
+				std::memcpy(digits, char_table_4_digit_data + value, 4ULL);
+			} else if constexpr (digitCount == 8) {
+				const uint64_t abcd = value * 3518437209ULL >> 45;
+				std::memcpy(digits, char_table_4_digit_data + abcd, 4ULL);
+				std::memcpy(digits + 4, char_table_4_digit_data + value - abcd * 10000ULL, 4ULL);
+			} else if constexpr (digitCount == 12) {
+				const uint64_t abcd = value / 100000000ULL;
+				writeDigits<4>(digits, abcd);
+				writeDigits<8>(digits + 4, value - abcd * 100000000ULL);
+			} else {
+				const uint64_t abcd		= value / 10000000000000000ULL;
+				const uint64_t lower	= value - abcd * 10000000000000000ULL;
+				const uint64_t efghijkl = multiply_and_shift::impl(lower);
+				writeDigits<4>(digits, abcd);
+				writeDigits<8>(digits + 4, efghijkl);
+				writeDigits<8>(digits + 12, lower - efghijkl * 100000000ULL);
+			}
+		}
+
+		template<uint64_t digitCount = maxDigits> JSONIFIER_INLINE static char* impl(char* __restrict buf JSONIFIER_LIFETIME_BOUND, const v_type value) noexcept {
+			const uint64_t length{ fastDigitCount(value) };
+			if constexpr (digitCount <= 8 && std::endian::native == std::endian::little) {
+				using packed_type = std::conditional_t<digitCount == 4, uint32_t, uint64_t>;
+				packed_type packed;
+				writeDigits<digitCount>(reinterpret_cast<char*>(&packed), value);
+				packed >>= (digitCount - length) * 8;
+				std::memcpy(buf, &packed, digitCount);
+			} else {
+				char digits[digitCount * 2];
+				writeDigits<digitCount>(digits, value);
+				std::memcpy(buf, digits + digitCount - length, digitCount);
+			}
+			return buf + length;
+		}
+	};
+
+	template<concepts::int_types v_type> struct to_chars_branchless<v_type> {
+		using unsigned_type = std::make_unsigned_t<v_type>;
+		static constexpr uint64_t maxDigits{ to_chars_branchless<unsigned_type>::maxDigits };
+
+		JSONIFIER_INLINE static unsigned_type magnitude(const v_type value) noexcept {
+			constexpr unsigned_type shift_amount = static_cast<unsigned_type>(sizeof(v_type) * 8ULL - 1ULL);
+			const unsigned_type sign			 = static_cast<unsigned_type>(value >> shift_amount);
+			return (static_cast<unsigned_type>(value) ^ sign) - sign;
+		}
+
+		template<uint64_t digitCount = maxDigits> JSONIFIER_INLINE static char* impl(char* __restrict buf JSONIFIER_LIFETIME_BOUND, const v_type value) noexcept {
+			*buf = '-';
+			return to_chars_branchless<unsigned_type>::template impl<digitCount>(buf + static_cast<uint64_t>(value < 0), magnitude(value));
+		}
+	};
+
 };// namespace internal
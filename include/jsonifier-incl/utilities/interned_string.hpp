@@ -0,0 +1,226 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// https://github.com/RealTimeChris/jsonifier
+
+#pragma once
+
+#include <jsonifier-incl/containers/unordered_map.hpp>
+#include <memory>
+
+namespace jsonifier {
+
+	class string_pool;
+
+	class interned_string {
+	  public:
+		friend class string_pool;
+
+		using value_type = char;
+		using size_type	 = uint64_t;
+
+		JSONIFIER_INLINE interned_string() noexcept = default;
+
+		JSONIFIER_INLINE explicit interned_string(std::string_view stringNew);
+
+		JSONIFIER_INLINE interned_string(std::string_view stringNew, string_pool& pool);
+
+		JSONIFIER_INLINE string_view_ptr data() const noexcept {
+			return dataVal;
+		}
+
+		JSONIFIER_INLINE size_type size() const noexcept {
+			return sizeVal;
+		}
+
+		JSONIFIER_INLINE bool empty() const noexcept {
+			return sizeVal == 0;
+		}
+
+		JSONIFIER_INLINE std::string_view view() const noexcept {
+			return std::string_view{ dataVal, sizeVal };
+		}
+
+		JSONIFIER_INLINE operator std::string_view() const noexcept {
+			return view();
+		}
+
+		JSONIFIER_INLINE friend bool operator==(const interned_string& lhs, const interned_string& rhs) noexcept {
+			return (lhs.dataVal == rhs.dataVal && lhs.sizeVal == rhs.sizeVal) || lhs.view() == rhs.view();
+		}
+
+		JSONIFIER_INLINE friend bool operator==(const interned_string& lhs, std::string_view rhs) noexcept {
+			return lhs.view() == rhs;
+		}
+
+		JSONIFIER_INLINE friend bool operator<(const interned_string& lhs, const interned_string& rhs) noexcept {
+			return lhs.view() < rhs.view();
+		}
+
+		JSONIFIER_INLINE friend std::ostream& operator<<(std::ostream& os, const interned_string& value) {
+			os << value.view();
+			return os;
+		}
+
+	  protected:
+		string_view_ptr dataVal{ "" };
+		size_type sizeVal{};
+
+		JSONIFIER_INLINE interned_string(string_view_ptr dataNew, size_type sizeNew) noexcept : dataVal{ dataNew }, sizeVal{ sizeNew } {
+		}
+	};
+
+	class string_pool {
+	  public:
+		static constexpr uint64_t chunkSize{ 64 * 1024 };
+
+		JSONIFIER_INLINE string_pool() noexcept = default;
+		JSONIFIER_INLINE string_pool(string_pool&&) noexcept			= default;
+		JSONIFIER_INLINE string_pool& operator=(string_pool&&) noexcept = default;
+		string_pool(const string_pool&)									= delete;
+		string_pool& operator=(const string_pool&)						= delete;
+
+		JSONIFIER_INLINE interned_string intern(std::string_view stringNew) {
+			if JSONIFIER_UNLIKELY (stringNew.empty()) {
+				return interned_string{};
+			}
+			++internCount;
+			if (const auto iter = index.find(stringNew); iter != index.end()) {
+				return interned_string{ iter->first.data(), iter->first.size() };
+			}
+			const std::string_view stored = store(stringNew);
+			index.try_emplace(stored);
+			return interned_string{ stored.data(), stored.size() };
+		}
+
+		JSONIFIER_INLINE uint64_t size() const noexcept {
+			return index.size();
+		}
+
+		JSONIFIER_INLINE uint64_t byteCount() const noexcept {
+			return storedBytes;
+		}
+
+		JSONIFIER_INLINE uint64_t requestCount() const noexcept {
+			return internCount;
+		}
+
+		JSONIFIER_INLINE void clear() noexcept {
+			index.clear();
+			chunks.clear();
+			chunkPtr	   = nullptr;
+			chunkRemaining = 0;
+			storedBytes	   = 0;
+			internCount	   = 0;
+		}
+
+	  protected:
+		unordered_map<std::string_view, uint8_t> index{};
+		std::vector<std::unique_ptr<char[]>> chunks{};
+		char* chunkPtr{};
+		uint64_t chunkRemaining{};
+		uint64_t storedBytes{};
+		uint64_t internCount{};
+
+		JSONIFIER_INLINE std::string_view store(std::string_view stringNew) {
+			const uint64_t length = stringNew.size();
+			char* target{};
+			if (length > chunkSize / 4) {
+				target = chunks.emplace(chunks.begin(), std::make_unique<char[]>(length))->get();
+			} else {
+				if (length > chunkRemaining) {
+					chunkPtr	   = chunks.emplace_back(std::make_unique<char[]>(chunkSize)).get();
+					chunkRemaining = chunkSize;
+				}
+				target = chunkPtr;
+				chunkPtr += length;
+				chunkRemaining -= length;
+			}
+			std::memcpy(target, stringNew.data(), length);
+			storedBytes += length;
+			return std::string_view{ target, length };
+		}
+	};
+
+}
+
+namespace jsonifier::internal {
+
+#if JSONIFIER_COMPILER_CLANG
+	#pragma clang diagnostic push
+	#pragma clang diagnostic ignored "-Wexit-time-destructors"
+#endif
+	JSONIFIER_INLINE string_pool*& activeStringPool() noexcept {
+		thread_local string_pool* pool{};
+		return pool;
+	}
+
+	JSONIFIER_INLINE string_pool& currentStringPool() noexcept {
+		if (auto pool = activeStringPool(); pool) {
+			return *pool;
+		}
+		thread_local string_pool pool{};
+		return pool;
+	}
+#if JSONIFIER_COMPILER_CLANG
+	#pragma clang diagnostic pop
+#endif
+
+	struct string_pool_scope {
+		JSONIFIER_INLINE explicit string_pool_scope(string_pool* pool) noexcept : previous{ activeStringPool() } {
+			if (pool) {
+				activeStringPool() = pool;
+			}
+		}
+
+		JSONIFIER_INLINE ~string_pool_scope() noexcept {
+			activeStringPool() = previous;
+		}
+
+		string_pool_scope(const string_pool_scope&)			   = delete;
+		string_pool_scope& operator=(const string_pool_scope&) = delete;
+
+	  protected:
+		string_pool* previous{};
+	};
+
+}
+
+namespace jsonifier {
+
+	JSONIFIER_INLINE interned_string::interned_string(std::string_view stringNew) : interned_string{ internal::currentStringPool().intern(stringNew) } {
+	}
+
+	JSONIFIER_INLINE interned_string::interned_string(std::string_view stringNew, string_pool& pool) : interned_string{ pool.intern(stringNew) } {
+	}
+
+}
+
+namespace std {
+
+	template<> struct hash<jsonifier::interned_string> : public std::hash<std::string_view> {
+		uint64_t operator()(const jsonifier::interned_string& stringNew) const noexcept {
+			return std::hash<std::string_view>::operator()(stringNew.view());
+		}
+	};
+
+}
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <jsonifier-incl/utilities/reflection.hpp>
+#include <jsonifier-incl/utilities/get_enum_name.hpp>
 
 namespace jsonifier::internal {
 
@@ -65,6 +66,33 @@ namespace jsonifier::internal {
 		return makeTuple(makeJsonEntityAuto<sizeof...(values), indices, values>()...);
 	}
 
+	template<auto valueNew, string_literal nameNew> struct enum_entity {
+		using value_type = decltype(valueNew);
+		static constexpr value_type value{ valueNew };
+		static constexpr string_literal name{ nameNew };
+	};
+
+	template<typename value_type>
+	concept is_enum_entity = requires {
+		typename value_type::value_type;
+		value_type::value;
+		value_type::name;
+	} && std::is_enum_v<typename value_type::value_type>;
+
+	template<auto value> static constexpr auto makeEnumEntityAuto() noexcept {
+		if constexpr (is_enum_entity<decltype(value)>) {
+			return value;
+		} else {
+			static_assert(std::is_enum_v<decltype(value)>, "All arguments passed to createEnum must be enumerators or enum entities.");
+			constexpr auto nameNew = getEnumName<value>();
+			return enum_entity<value, stringLiteralFromView<nameNew.size()>(nameNew)>{};
+		}
+	}
+
+	template<string_literal nameNew> struct variant_tag {
+		static constexpr string_literal name{ nameNew };
+	};
+
 	template<auto element, typename value_type_new> JSONIFIER_INLINE decltype(auto) getMember(value_type_new& value) noexcept {
 		using value_type = remove_cvref_t<decltype(element)>;
 		if constexpr (std::is_member_object_pointer_v<value_type>) {
@@ -88,4 +116,16 @@ namespace jsonifier {
 		return internal::createValueImpl<values...>(jsonifier::internal::make_integer_sequence<sizeof...(values)>{});
 	}
 
+	template<auto value, internal::string_literal nameNew> static constexpr auto makeEnumEntity() {
+		return internal::enum_entity<value, nameNew>{};
+	}
+
+	template<auto... values> static constexpr auto createEnum() noexcept {
+		return internal::makeTuple(internal::makeEnumEntityAuto<values>()...);
+	}
+
+	template<internal::string_literal... names> static constexpr auto createVariantTags() noexcept {
+		return internal::makeTuple(internal::variant_tag<names>{}...);
+	}
+
 }
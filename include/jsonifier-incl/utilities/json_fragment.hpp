@@ -0,0 +1,93 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// https://github.com/RealTimeChris/jsonifier
+
+#pragma once
+
+#include <jsonifier-incl/utilities/utility.hpp>
+#include <memory>
+#include <string>
+
+namespace jsonifier {
+
+	class json_fragment {
+	  public:
+		using size_type = uint64_t;
+
+		JSONIFIER_INLINE json_fragment() noexcept = default;
+
+		JSONIFIER_INLINE explicit json_fragment(std::string_view jsonNew) noexcept : dataVal{ jsonNew.data() }, sizeVal{ jsonNew.size() } {
+		}
+
+		JSONIFIER_INLINE explicit json_fragment(std::shared_ptr<const std::string> storageNew) noexcept
+			: storage{ internal::move(storageNew) }, dataVal{ storage ? storage->data() : "" }, sizeVal{ storage ? storage->size() : 0 } {
+		}
+
+		JSONIFIER_INLINE string_view_ptr data() const noexcept {
+			return dataVal;
+		}
+
+		JSONIFIER_INLINE size_type size() const noexcept {
+			return sizeVal;
+		}
+
+		JSONIFIER_INLINE bool empty() const noexcept {
+			return sizeVal == 0;
+		}
+
+		JSONIFIER_INLINE std::string_view view() const noexcept {
+			return std::string_view{ dataVal, sizeVal };
+		}
+
+		JSONIFIER_INLINE bool owning() const noexcept {
+			return storage != nullptr;
+		}
+
+		JSONIFIER_INLINE json_fragment& detach() {
+			if (!storage) {
+				storage = std::make_shared<const std::string>(dataVal, sizeVal);
+				dataVal = storage->data();
+			}
+			return *this;
+		}
+
+		JSONIFIER_INLINE friend bool operator==(const json_fragment& lhs, const json_fragment& rhs) noexcept {
+			return lhs.view() == rhs.view();
+		}
+
+		JSONIFIER_INLINE friend bool operator==(const json_fragment& lhs, std::string_view rhs) noexcept {
+			return lhs.view() == rhs;
+		}
+
+		JSONIFIER_INLINE friend std::ostream& operator<<(std::ostream& os, const json_fragment& value) {
+			os << value.view();
+			return os;
+		}
+
+	  protected:
+		std::shared_ptr<const std::string> storage{};
+		string_view_ptr dataVal{ "" };
+		size_type sizeVal{};
+	};
+
+}
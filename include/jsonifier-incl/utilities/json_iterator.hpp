@@ -141,6 +141,11 @@ namespace jsonifier::internal {
 		}
 
 		template<parse_statuses errorType> [[nodiscard]] bool reject() noexcept {
+			if constexpr (parseOpts.failFast) {
+				if (!errors->empty()) {
+					return false;
+				}
+			}
 			errors->emplace_back(error::constructError<status_classes::parsing, errorType>(rootIter, iter, endIter));
 			return false;
 		}
@@ -479,6 +484,28 @@ namespace jsonifier::internal {
 			}
 		}
 
+		JSONIFIER_INLINE bool iterateStringView(string_view& value) noexcept {
+			++iter;
+			if JSONIFIER_UNLIKELY (iter >= endIter) {
+				return reject<parse_statuses::unexpected_end_of_input>();
+			}
+			auto iterStart	  = iter;
+			const auto newPtr = string_parser<parseOpts>::impl(iter, stringBuffer->data(), static_cast<uint64_t>(endIter - iter));
+			if JSONIFIER_LIKELY (newPtr) {
+				const auto newSize = static_cast<uint64_t>(newPtr - stringBuffer->data());
+				value			   = string_view{ stringBuffer->data(), newSize };
+				++iter;
+				if JSONIFIER_UNLIKELY (iter > endIter) {
+					return reject<parse_statuses::unexpected_end_of_input>();
+				}
+				return true;
+			}
+			JSONIFIER_ELSE_UNLIKELY(else) {
+				iter = iterStart;
+				return reject<parse_statuses::invalid_string_characters>();
+			}
+		}
+
 		JSONIFIER_INLINE sep_result collectObjectSeparator() noexcept {
 			if constexpr (parseOpts.nullTerminated) {
 				const char c = *iter;
@@ -761,6 +788,11 @@ namespace jsonifier::internal {
 		}
 
 		template<parse_statuses errorType> [[nodiscard]] bool reject() noexcept {
+			if constexpr (parseOpts.failFast) {
+				if (!errors->empty()) {
+					return false;
+				}
+			}
 			errors->emplace_back(error::constructError<status_classes::parsing, errorType>(rootIter, iter, endIter));
 			return false;
 		}
@@ -1122,6 +1154,28 @@ namespace jsonifier::internal {
 				return reject<parse_statuses::invalid_string_characters>();
 			}
 		}
+
+		JSONIFIER_INLINE bool iterateStringView(string_view& value) noexcept {
+			++iter;
+			if JSONIFIER_UNLIKELY (iter >= endIter) {
+				return reject<parse_statuses::unexpected_end_of_input>();
+			}
+			auto iterStart	  = iter;
+			const auto newPtr = string_parser<parseOpts>::impl(iter, stringBuffer->data(), static_cast<uint64_t>(endIter - iter));
+			if JSONIFIER_LIKELY (newPtr) {
+				const auto newSize = static_cast<uint64_t>(newPtr - stringBuffer->data());
+				value			   = string_view{ stringBuffer->data(), newSize };
+				++iter;
+				if JSONIFIER_UNLIKELY (iter > endIter) {
+					return reject<parse_statuses::unexpected_end_of_input>();
+				}
+				return true;
+			}
+			JSONIFIER_ELSE_UNLIKELY(else) {
+				iter = iterStart;
+				return reject<parse_statuses::invalid_string_characters>();
+			}
+		}
 	};
 
 	static constexpr auto validPostPrimitiveTable{ [] {
@@ -1243,6 +1297,11 @@ namespace jsonifier::internal {
 		}
 
 		template<parse_statuses errorType> [[nodiscard]] bool reject() noexcept {
+			if constexpr (parseOpts.failFast) {
+				if (!errors->empty()) {
+					return false;
+				}
+			}
 			errors->emplace_back(error::constructError<status_classes::parsing, errorType>(stringRootIter, &stringRootIter[*iter], stringEndIter));
 			return false;
 		}
@@ -1519,6 +1578,20 @@ namespace jsonifier::internal {
 			}
 		}
 
+		JSONIFIER_INLINE bool iterateStringView(string_view& value) noexcept {
+			string_view_ptr strPtr = currentPtr() + 1;
+			const auto newPtr	   = string_parser<parseOpts>::impl(strPtr, stringBuffer->data(), static_cast<uint64_t>(stringEndIter - strPtr));
+			if JSONIFIER_LIKELY (newPtr) {
+				const auto newSize = static_cast<uint64_t>(newPtr - stringBuffer->data());
+				value			   = string_view{ stringBuffer->data(), newSize };
+				++iter;
+				return true;
+			}
+			JSONIFIER_ELSE_UNLIKELY(else) {
+				return reject<parse_statuses::invalid_string_characters>();
+			}
+		}
+
 		JSONIFIER_INLINE sep_result collectObjectSeparator() noexcept {
 			if JSONIFIER_LIKELY (notAtEndPre()) {
 				const char c = static_cast<char>(*currentPtr());
@@ -1663,6 +1736,11 @@ namespace jsonifier::internal {
 		}
 
 		template<parse_statuses errorType> [[nodiscard]] bool reject() noexcept {
+			if constexpr (parseOpts.failFast) {
+				if (!errors->empty()) {
+					return false;
+				}
+			}
 			errors->emplace_back(error::constructError<status_classes::parsing, errorType>(stringRootIter, &stringRootIter[*iter], stringEndIter));
 			return false;
 		}
@@ -1958,6 +2036,20 @@ namespace jsonifier::internal {
 			}
 		}
 
+		JSONIFIER_INLINE bool iterateStringView(string_view& value) noexcept {
+			string_view_ptr strPtr = currentPtr() + 1;
+			const auto newPtr	   = string_parser<parseOpts>::impl(strPtr, stringBuffer->data(), static_cast<uint64_t>(stringEndIter - strPtr));
+			if JSONIFIER_LIKELY (newPtr) {
+				const auto newSize = static_cast<uint64_t>(newPtr - stringBuffer->data());
+				value			   = string_view{ stringBuffer->data(), newSize };
+				++iter;
+				return true;
+			}
+			JSONIFIER_ELSE_UNLIKELY(else) {
+				return reject<parse_statuses::invalid_string_characters>();
+			}
+		}
+
 		JSONIFIER_INLINE sep_result collectObjectSeparator() noexcept {
 			if JSONIFIER_LIKELY (notAtEndPre()) {
 				const char c = static_cast<char>(*currentPtr());
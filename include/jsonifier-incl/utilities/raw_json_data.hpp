@@ -24,6 +24,12 @@
 
 #include <jsonifier-incl/utilities/hash_map.hpp>
 #include <jsonifier-incl/utilities/string.hpp>
+#include <jsonifier-incl/utilities/string_utils.hpp>
+#include <jsonifier-incl/utilities/str_to_d.hpp>
+#include <jsonifier-incl/utilities/str_to_i.hpp>
+#include <jsonifier-incl/utilities/simd.hpp>
+#include <jsonifier-incl/containers/flat_map.hpp>
+#include <memory>
 
 namespace jsonifier {
 
@@ -32,19 +38,31 @@ namespace jsonifier {
 	struct json_number {
 		inline json_number() noexcept = default;
 
-		inline json_number(const string& stringNew) noexcept : rawJson{ stringNew } {
+		inline json_number(string_view stringNew) noexcept : rawJson{ stringNew } {
 		}
 
-		inline uint64_t getUint() const {
-			return strToUint64(rawJson);
+		inline uint64_t getUint() const noexcept {
+			uint64_t newValue{};
+			if JSONIFIER_LIKELY (rawJson.size() > 0) {
+				internal::integer_parser<uint64_t>::parseInt(newValue, rawJson.data(), rawJson.data() + rawJson.size());
+			}
+			return newValue;
 		}
 
-		inline int64_t getInt() const {
-			return strToInt64(rawJson);
+		inline int64_t getInt() const noexcept {
+			int64_t newValue{};
+			if JSONIFIER_LIKELY (rawJson.size() > 0) {
+				internal::integer_parser<int64_t>::parseInt(newValue, rawJson.data(), rawJson.data() + rawJson.size());
+			}
+			return newValue;
 		}
 
-		inline double getDouble() const {
-			return strToDouble(rawJson);
+		inline double getDouble() const noexcept {
+			double newValue{};
+			if JSONIFIER_LIKELY (rawJson.size() > 0) {
+				internal::parseFloat(newValue, rawJson.data(), rawJson.data() + rawJson.size());
+			}
+			return newValue;
 		}
 
 		inline friend bool operator!=(const json_number& lhs, const json_number& rhs) {
@@ -58,228 +76,679 @@ namespace jsonifier {
 		string_view rawJson{};
 	};
 
-	class raw_json_data {
+}
+
+namespace jsonifier::internal {
+
+	struct raw_json_node {
+		uint32_t offset{};
+		uint32_t length{};
+		uint32_t next{};
+		uint32_t count{};
+		uint32_t children{};
+		uint32_t slots{};
+		json_type type{ json_type::null };
+	};
+
+	JSONIFIER_INLINE bool unescapeRawJsonString(string_view_ptr start, uint64_t length, string& newString) noexcept {
+		if (std::memchr(start, '\\', length) == nullptr) {
+			newString = string{ start, length };
+			return true;
+		}
+		newString.resize(length + 64);
+		string_view_ptr iter = start;
+		const auto newPtr	 = string_parser<parse_options{}>::impl(iter, newString.data(), length + 1);
+		newString.resize(newPtr ? static_cast<uint64_t>(newPtr - newString.data()) : 0);
+		return newPtr != nullptr && iter == start + length + 1;
+	}
+
+	JSONIFIER_INLINE string unescapeRawJsonString(string_view_ptr start, uint64_t length) noexcept {
+		string newString{};
+		unescapeRawJsonString(start, length, newString);
+		return newString;
+	}
+
+	struct raw_json_storage {
+		string source{};
+		string escapedKeys{};
+		std::vector<raw_json_node> nodes{};
+		std::vector<uint32_t> elements{};
+		std::vector<uint8_t> keyTags{};
+		std::vector<uint32_t> keySlots{};
+
+		JSONIFIER_INLINE string_view key(uint32_t keyIndex) const noexcept {
+			const auto& keyNode = nodes[keyIndex];
+			return keyNode.count > 0 ? string_view{ escapedKeys.data() + keyNode.children, keyNode.count }
+									 : string_view{ source.data() + keyNode.offset + 1, keyNode.length - 2 };
+		}
+	};
+
+	class raw_json_builder {
 	  public:
-		using object_type = std::unordered_map<string, raw_json_data>;
-		using string_type = string;
-		using array_type  = std::vector<raw_json_data>;
-		using number_type = json_number;
-		using bool_type	  = bool;
-		using null_type	  = std::nullptr_t;
-		using error_type  = std::monostate;
-		using value_type  = std::variant<object_type, array_type, string_type, number_type, bool_type, null_type, error_type>;
+		inline raw_json_builder(raw_json_storage& storageNew, const uint32_t* tapeNew, uint64_t tapeCount, uint32_t baseNew, uint64_t maxDepthNew) noexcept
+			: storage{ storageNew }, iter{ tapeNew }, endIter{ tapeNew + tapeCount }, base{ baseNew }, maxDepth{ maxDepthNew } {
+		}
+
+		inline parse_statuses impl() noexcept {
+			storage.nodes.clear();
+			storage.escapedKeys.clear();
+			storage.elements.clear();
+			storage.keyTags.clear();
+			storage.keySlots.clear();
+			storage.nodes.reserve(countNodes());
+			if JSONIFIER_UNLIKELY (!buildValue(0)) {
+				return status;
+			}
+			if JSONIFIER_UNLIKELY (iter != endIter) {
+				fail(parse_statuses::unfinished_input, position());
+				return status;
+			}
+			collectElements();
+			return parse_statuses::success;
+		}
 
-		inline raw_json_data() noexcept {
-			value = null_type{};
+		inline uint64_t getErrorOffset() const noexcept {
+			return errorOffset;
 		}
 
-		template<typename iterator_type> inline raw_json_data(iterator_type& iterator, const string& jsonDataNew) noexcept {
-			internal::json_iterator<parse_options{}, string_view_ptr, string_base<char, 1024 * 1024>> localIterator{ &iterator.getStringBuffer(), &iterator.getErrors(),
-				jsonDataNew.data(), jsonDataNew.data() + jsonDataNew.size() };
-			value	 = constructValueFromRawJsonData(localIterator, jsonDataNew);
-			jsonData = jsonDataNew;
+	  protected:
+		raw_json_storage& storage;
+		const uint32_t* iter{};
+		const uint32_t* endIter{};
+		uint32_t base{};
+		uint64_t maxDepth{};
+		uint64_t errorOffset{};
+		parse_statuses status{};
+		string unescaped{};
+
+		inline uint32_t position() const noexcept {
+			return iter < endIter ? *iter - base : static_cast<uint32_t>(storage.source.size());
 		}
 
-		inline json_type getType() const noexcept {
-			if (std::holds_alternative<object_type>(value)) {
-				return json_type::object;
-			} else if (std::holds_alternative<array_type>(value)) {
-				return json_type::array;
-			} else if (std::holds_alternative<string_type>(value)) {
-				return json_type::string;
-			} else if (std::holds_alternative<number_type>(value)) {
-				return json_type::number;
-			} else if (std::holds_alternative<bool_type>(value)) {
-				return json_type::boolean;
-			} else if (std::holds_alternative<null_type>(value)) {
-				return json_type::null;
+		inline char current() const noexcept {
+			return storage.source[position()];
+		}
+
+		inline bool fail(parse_statuses statusNew, uint64_t offset) noexcept {
+			status		= statusNew;
+			errorOffset = offset;
+			return false;
+		}
+
+		inline uint64_t countNodes() const noexcept {
+			uint64_t count{};
+			for (const uint32_t* current = iter; current < endIter; ++current) {
+				const char c = storage.source[*current - base];
+				count += (c != ',' && c != ':' && c != '}' && c != ']');
+			}
+			return count;
+		}
+
+		inline uint32_t scalarEnd(uint32_t offset) const noexcept {
+			uint32_t end = position();
+			while (end > offset && whitespaceTable[static_cast<uint8_t>(storage.source[end - 1])]) {
+				--end;
+			}
+			return end;
+		}
+
+		inline bool buildValue(uint64_t depth) noexcept {
+			if JSONIFIER_UNLIKELY (iter >= endIter) {
+				return fail(parse_statuses::unexpected_end_of_input, storage.source.size());
+			}
+			if JSONIFIER_UNLIKELY (depth >= maxDepth) {
+				return fail(parse_statuses::exceeded_max_depth, position());
+			}
+			const uint32_t offset = position();
+			const auto index	  = static_cast<uint32_t>(storage.nodes.size());
+			storage.nodes.emplace_back().offset = offset;
+			switch (storage.source[offset]) {
+				case '{': {
+					if JSONIFIER_UNLIKELY (!buildObject(index, depth)) {
+						return false;
+					}
+					break;
+				}
+				case '[': {
+					if JSONIFIER_UNLIKELY (!buildArray(index, depth)) {
+						return false;
+					}
+					break;
+				}
+				case '"': {
+					++iter;
+					const uint32_t end = scalarEnd(offset);
+					if JSONIFIER_UNLIKELY (end - offset < 2 || storage.source[end - 1] != '"') {
+						return fail(parse_statuses::unexpected_string_end, offset);
+					}
+					storage.nodes[index].type	= json_type::string;
+					storage.nodes[index].length = end - offset;
+					if JSONIFIER_UNLIKELY (std::memchr(storage.source.data() + offset + 1, '\\', end - offset - 2) != nullptr &&
+						!unescapeRawJsonString(storage.source.data() + offset + 1, end - offset - 2, unescaped)) {
+						return fail(parse_statuses::invalid_string_characters, offset);
+					}
+					break;
+				}
+				case 't': {
+					if JSONIFIER_UNLIKELY (!buildLiteral(index, offset, "true", json_type::boolean, parse_statuses::invalid_bool_value)) {
+						return false;
+					}
+					break;
+				}
+				case 'f': {
+					if JSONIFIER_UNLIKELY (!buildLiteral(index, offset, "false", json_type::boolean, parse_statuses::invalid_bool_value)) {
+						return false;
+					}
+					break;
+				}
+				case 'n': {
+					if JSONIFIER_UNLIKELY (!buildLiteral(index, offset, "null", json_type::null, parse_statuses::invalid_null_value)) {
+						return false;
+					}
+					break;
+				}
+				case '-':
+					[[fallthrough]];
+				case '0':
+					[[fallthrough]];
+				case '1':
+					[[fallthrough]];
+				case '2':
+					[[fallthrough]];
+				case '3':
+					[[fallthrough]];
+				case '4':
+					[[fallthrough]];
+				case '5':
+					[[fallthrough]];
+				case '6':
+					[[fallthrough]];
+				case '7':
+					[[fallthrough]];
+				case '8':
+					[[fallthrough]];
+				case '9': {
+					++iter;
+					const uint32_t end = scalarEnd(offset);
+					if JSONIFIER_UNLIKELY (!validNumber(offset, end)) {
+						return fail(parse_statuses::invalid_number_value, offset);
+					}
+					storage.nodes[index].type	= json_type::number;
+					storage.nodes[index].length = end - offset;
+					break;
+				}
+				default: {
+					return fail(parse_statuses::unexpected_token, offset);
+				}
+			}
+			storage.nodes[index].next = static_cast<uint32_t>(storage.nodes.size());
+			return true;
+		}
+
+		inline uint32_t consumeDigits(uint32_t x, uint32_t end) const noexcept {
+			while (x < end && JSONIFIER_IS_DIGIT(storage.source[x])) {
+				++x;
+			}
+			return x;
+		}
+
+		inline bool validNumber(uint32_t x, uint32_t end) const noexcept {
+			x += storage.source[x] == '-';
+			if (x < end && storage.source[x] == '0') {
+				++x;
 			} else {
-				return json_type::unset;
+				const uint32_t digitsStart = x;
+				x						   = consumeDigits(x, end);
+				if (x == digitsStart) {
+					return false;
+				}
+			}
+			if (x < end && storage.source[x] == '.') {
+				const uint32_t digitsStart = ++x;
+				x						   = consumeDigits(x, end);
+				if (x == digitsStart) {
+					return false;
+				}
 			}
+			if (x < end && (storage.source[x] == 'e' || storage.source[x] == 'E')) {
+				++x;
+				x += x < end && (storage.source[x] == '-' || storage.source[x] == '+');
+				const uint32_t digitsStart = x;
+				x						   = consumeDigits(x, end);
+				if (x == digitsStart) {
+					return false;
+				}
+			}
+			return x == end;
 		}
 
-		inline const object_type& getObject() const noexcept {
-			return std::get<object_type>(value);
+		inline bool buildLiteral(uint32_t index, uint32_t offset, std::string_view literal, json_type type, parse_statuses error) noexcept {
+			++iter;
+			const uint32_t end = scalarEnd(offset);
+			if JSONIFIER_UNLIKELY (std::string_view{ storage.source.data() + offset, end - offset } != literal) {
+				return fail(error, offset);
+			}
+			storage.nodes[index].type	= type;
+			storage.nodes[index].length = end - offset;
+			return true;
+		}
+
+		inline bool buildObject(uint32_t index, uint64_t depth) noexcept {
+			storage.nodes[index].type = json_type::object;
+			++iter;
+			if (iter < endIter && current() == '}') {
+				storage.nodes[index].length = position() + 1 - storage.nodes[index].offset;
+				++iter;
+				return true;
+			}
+			while (true) {
+				if JSONIFIER_UNLIKELY (iter >= endIter || current() != '"') {
+					return fail(parse_statuses::missing_key_start, position());
+				}
+				const auto keyIndex = static_cast<uint32_t>(storage.nodes.size());
+				if JSONIFIER_UNLIKELY (!buildValue(depth + 1)) {
+					return false;
+				}
+				collectEscapedKey(storage.nodes[keyIndex]);
+				++storage.nodes[index].count;
+				if JSONIFIER_UNLIKELY (iter >= endIter || current() != ':') {
+					return fail(parse_statuses::missing_colon, position());
+				}
+				++iter;
+				if JSONIFIER_UNLIKELY (!buildValue(depth + 1)) {
+					return false;
+				}
+				if JSONIFIER_UNLIKELY (iter >= endIter) {
+					return fail(parse_statuses::missing_object_end, position());
+				}
+				const char c = current();
+				if (c == '}') {
+					storage.nodes[index].length = position() + 1 - storage.nodes[index].offset;
+					++iter;
+					return true;
+				} else if JSONIFIER_UNLIKELY (c != ',') {
+					return fail(parse_statuses::missing_comma, position());
+				}
+				++iter;
+			}
 		}
 
-		inline object_type& getObject() noexcept {
-			return std::get<object_type>(value);
+		inline bool buildArray(uint32_t index, uint64_t depth) noexcept {
+			storage.nodes[index].type = json_type::array;
+			++iter;
+			if (iter < endIter && current() == ']') {
+				storage.nodes[index].length = position() + 1 - storage.nodes[index].offset;
+				++iter;
+				return true;
+			}
+			while (true) {
+				if JSONIFIER_UNLIKELY (!buildValue(depth + 1)) {
+					return false;
+				}
+				++storage.nodes[index].count;
+				if JSONIFIER_UNLIKELY (iter >= endIter) {
+					return fail(parse_statuses::missing_array_end, position());
+				}
+				const char c = current();
+				if (c == ']') {
+					storage.nodes[index].length = position() + 1 - storage.nodes[index].offset;
+					++iter;
+					return true;
+				} else if JSONIFIER_UNLIKELY (c != ',') {
+					return fail(parse_statuses::missing_comma, position());
+				}
+				++iter;
+			}
 		}
 
-		inline const array_type& getArray() const noexcept {
-			return std::get<array_type>(value);
+		inline void collectElements() noexcept {
+			uint64_t elementCount{};
+			for (const auto& node: storage.nodes) {
+				elementCount += (node.type == json_type::array || node.type == json_type::object) ? node.count : 0;
+			}
+			storage.elements.reserve(elementCount);
+			storage.keyTags.reserve(elementCount);
+			for (uint32_t x = 0; x < storage.nodes.size(); ++x) {
+				auto& node = storage.nodes[x];
+				if (node.type == json_type::array) {
+					node.children = static_cast<uint32_t>(storage.elements.size());
+					for (uint32_t y = x + 1; y < node.next; y = storage.nodes[y].next) {
+						storage.elements.emplace_back(y);
+						storage.keyTags.emplace_back(0);
+					}
+				} else if (node.type == json_type::object) {
+					node.children = static_cast<uint32_t>(storage.elements.size());
+					for (uint32_t y = x + 1; y < node.next; y = storage.nodes[y + 1].next) {
+						const auto key = storage.key(y);
+						storage.elements.emplace_back(y);
+						storage.keyTags.emplace_back(flat_key_index::tag(key.data(), key.size()));
+					}
+					if (node.count >= flat_key_index::hashThreshold) {
+						collectSlots(node);
+					}
+				}
+			}
 		}
 
-		inline array_type& getArray() noexcept {
-			return std::get<array_type>(value);
+		inline void collectEscapedKey(raw_json_node& keyNode) noexcept {
+			if JSONIFIER_UNLIKELY (std::memchr(storage.source.data() + keyNode.offset + 1, '\\', keyNode.length - 2) != nullptr) {
+				keyNode.children = static_cast<uint32_t>(storage.escapedKeys.size());
+				keyNode.count	 = static_cast<uint32_t>(unescaped.size());
+				storage.escapedKeys.append(unescaped.data(), unescaped.size());
+			}
+		}
+
+		inline void collectSlots(raw_json_node& node) noexcept {
+			const uint64_t slotCount = flat_key_index::slotCount(node.count);
+			node.slots				 = static_cast<uint32_t>(storage.keySlots.size());
+			storage.keySlots.resize(storage.keySlots.size() + slotCount, flat_key_index::emptySlot);
+			for (uint32_t x = 0; x < node.count; ++x) {
+				const auto key = storage.key(storage.elements[node.children + x]);
+				flat_key_index::insert(storage.keySlots.data() + node.slots, slotCount, flat_key_index::hash(key.data(), key.size()), x);
+			}
+		}
+	};
+
+}
+
+namespace jsonifier {
+
+	class raw_json_array_view;
+	class raw_json_object_view;
+
+	class raw_json_data {
+	  public:
+		using object_type = raw_json_object_view;
+		using string_type = string;
+		using array_type  = raw_json_array_view;
+		using number_type = json_number;
+		using bool_type	  = bool;
+		using null_type	  = std::nullptr_t;
+
+		inline raw_json_data() noexcept = default;
+
+		inline raw_json_data(std::shared_ptr<const internal::raw_json_storage> storageNew, uint32_t indexNew) noexcept
+			: storage{ internal::move(storageNew) }, index{ indexNew } {
 		}
 
-		inline const string_type& getString() const noexcept {
-			return std::get<string_type>(value);
+		inline json_type getType() const noexcept {
+			return storage ? node().type : json_type::null;
 		}
 
-		inline string_type& getString() noexcept {
-			return std::get<string_type>(value);
+		inline object_type getObject() const noexcept;
+
+		inline array_type getArray() const noexcept;
+
+		inline string_view getStringView() const noexcept {
+			if JSONIFIER_LIKELY (getType() == json_type::string) {
+				return string_view{ storage->source.data() + node().offset + 1, node().length - 2 };
+			}
+			return {};
 		}
 
-		inline const number_type& getNumber() const noexcept {
-			return std::get<number_type>(value);
+		inline string_type getString() const noexcept {
+			const auto view = getStringView();
+			return internal::unescapeRawJsonString(view.data(), view.size());
 		}
 
-		inline number_type& getNumber() noexcept {
-			return std::get<number_type>(value);
+		inline number_type getNumber() const noexcept {
+			return getType() == json_type::number ? number_type{ rawJson() } : number_type{};
 		}
 
 		inline double getDouble() const noexcept {
-			return std::get<number_type>(value).getDouble();
+			return getNumber().getDouble();
 		}
 
 		inline int64_t getInt() const noexcept {
-			return std::get<number_type>(value).getInt();
+			return getNumber().getInt();
 		}
 
 		inline uint64_t getUint() const noexcept {
-			return std::get<number_type>(value).getUint();
+			return getNumber().getUint();
 		}
 
-		inline const bool_type& getBool() const noexcept {
-			return std::get<bool_type>(value);
+		inline bool_type getBool() const noexcept {
+			return getType() == json_type::boolean && storage->source[node().offset] == 't';
 		}
 
-		inline bool_type& getBool() noexcept {
-			return std::get<bool_type>(value);
-		}
+		template<std::integral index_type> inline raw_json_data operator[](index_type indexNew) const noexcept;
 
-		template<std::integral index_type> inline raw_json_data& operator[](index_type&& index) noexcept {
-			return (std::get<array_type>(value))[index];
-		}
+		template<std::convertible_to<string_view> key_type> inline raw_json_data operator[](key_type&& key) const noexcept;
 
-		template<std::integral index_type> inline const raw_json_data& operator[](index_type&& index) const noexcept {
-			return (std::get<array_type>(value))[index];
-		}
+		template<std::convertible_to<string_view> key_type> inline bool contains(key_type&& key) const noexcept;
 
-		template<std::convertible_to<string_view> key_type> inline raw_json_data& operator[](key_type&& key) noexcept {
-			if (std::holds_alternative<null_type>(value)) {
-				value = object_type{};
+		inline uint64_t size() const noexcept {
+			switch (getType()) {
+				case json_type::object:
+					[[fallthrough]];
+				case json_type::array: {
+					return node().count;
+				}
+				case json_type::string: {
+					return getString().size();
+				}
+				default: {
+					return 0;
+				}
 			}
-			auto& object = std::get<object_type>(value);
-			return object[key];
 		}
 
-		template<std::convertible_to<const string_view> key_type> inline const raw_json_data& operator[](key_type&& key) const noexcept {
-			const auto& object = std::get<object_type>(value);
-			return object.at(key);
+		inline string_view rawJson() const noexcept {
+			return storage ? string_view{ storage->source.data() + node().offset, node().length } : string_view{};
 		}
 
-		template<std::convertible_to<string_view> key_type> inline bool contains(key_type&& key) const noexcept {
-			if (!std::holds_alternative<object_type>(value)) {
+		inline bool operator==(const raw_json_data& other) const noexcept {
+			return rawJson() == other.rawJson();
+		}
+
+		template<parse_options options, typename context_type>
+		inline bool build(context_type& context, string_view_ptr data, uint64_t length, const uint32_t* tape, uint64_t tapeCount, uint32_t base) noexcept {
+			auto storageNew = std::make_shared<internal::raw_json_storage>();
+			storageNew->source.resize(length);
+			std::memcpy(storageNew->source.data(), data, length);
+			internal::raw_json_builder builder{ *storageNew, tape, tapeCount, base, options.maxDepth };
+			if (const auto status = builder.impl(); status != internal::parse_statuses::success) {
+				const string_view_ptr source = storageNew->source.data();
+				context.getErrors().emplace_back(
+					internal::error::constructError<internal::status_classes::parsing>(status, source, source + builder.getErrorOffset(), source + storageNew->source.size()));
+				storage.reset();
+				index = 0;
 				return false;
 			}
-			const auto& object = std::get<object_type>(value);
-			return object.contains(key);
+			storage = internal::move(storageNew);
+			index	= 0;
+			return true;
 		}
 
-		inline uint64_t size() const noexcept {
-			if (std::holds_alternative<object_type>(value)) {
-				return std::get<object_type>(value).size();
-			} else if (std::holds_alternative<array_type>(value)) {
-				return std::get<array_type>(value).size();
-			} else if (std::holds_alternative<string_type>(value)) {
-				return std::get<string_type>(value).size();
-			} else {
-				return 0;
+	  protected:
+		std::shared_ptr<const internal::raw_json_storage> storage{};
+		uint32_t index{};
+
+		inline const internal::raw_json_node& node() const noexcept {
+			return storage->nodes[index];
+		}
+	};
+
+	class raw_json_array_view {
+	  public:
+		class iterator {
+		  public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type		= raw_json_data;
+			using difference_type	= std::ptrdiff_t;
+			using reference			= raw_json_data;
+
+			inline iterator() noexcept = default;
+
+			inline iterator(const std::shared_ptr<const internal::raw_json_storage>* storageNew, const uint32_t* elementNew) noexcept
+				: storage{ storageNew }, element{ elementNew } {
+			}
+
+			inline raw_json_data operator*() const noexcept {
+				return raw_json_data{ *storage, *element };
+			}
+
+			inline iterator& operator++() noexcept {
+				++element;
+				return *this;
+			}
+
+			inline iterator operator++(int) noexcept {
+				iterator temp{ *this };
+				++element;
+				return temp;
+			}
+
+			inline bool operator==(const iterator& other) const noexcept {
+				return element == other.element;
 			}
+
+		  protected:
+			const std::shared_ptr<const internal::raw_json_storage>* storage{};
+			const uint32_t* element{};
+		};
+
+		inline raw_json_array_view() noexcept = default;
+
+		inline raw_json_array_view(std::shared_ptr<const internal::raw_json_storage> storageNew, uint32_t indexNew) noexcept
+			: storage{ internal::move(storageNew) }, index{ indexNew } {
 		}
 
-		inline string_view rawJson() const noexcept {
-			return jsonData;
+		inline iterator begin() const noexcept {
+			return storage ? iterator{ &storage, storage->elements.data() + storage->nodes[index].children } : iterator{};
 		}
 
-		inline const std::vector<internal::error>& getErrors() const noexcept {
-			return errors;
+		inline iterator end() const noexcept {
+			return storage ? iterator{ &storage, storage->elements.data() + storage->nodes[index].children + storage->nodes[index].count } : iterator{};
 		}
 
-		inline bool operator==(const raw_json_data& other) const noexcept {
-			return jsonData == other.jsonData && value == other.value;
+		inline raw_json_data operator[](uint64_t position) const noexcept {
+			return position < size() ? raw_json_data{ storage, storage->elements[storage->nodes[index].children + position] } : raw_json_data{};
+		}
+
+		inline uint64_t size() const noexcept {
+			return storage ? storage->nodes[index].count : 0;
+		}
+
+		inline bool empty() const noexcept {
+			return size() == 0;
 		}
 
 	  protected:
-		std::vector<internal::error> errors{};
-		value_type value{};
-		string jsonData{};
-
-		template<typename json_iterator_type> inline value_type constructValueFromRawJsonData(json_iterator_type& iterator, const string& jsonDataNew) noexcept {
-			static constexpr parse_options optionsNew{};
-			if (jsonDataNew.size() > 0) {
-				switch (jsonDataNew[0]) {
-					case '{': {
-						typename raw_json_data::object_type results{};
-						internal::parse_impl<typename raw_json_data::object_type, json_iterator_type, optionsNew>::impl(results, iterator);
-						if (iterator.getErrors().size() == 0) {
-							return value_type{ results };
-						} else {
-							return value_type{ null_type{} };
-						}
-					}
-					case '[': {
-						typename raw_json_data::array_type results{};
-						internal::parse_impl<typename raw_json_data::array_type, json_iterator_type, optionsNew>::impl(results, iterator);
-						if (iterator.getErrors().size() == 0) {
-							return value_type{ results };
-						} else {
-							return value_type{ null_type{} };
-						}
-					}
-					case '"': {
-						typename raw_json_data::string_type results{};
-						internal::parse_impl<typename raw_json_data::string_type, json_iterator_type, optionsNew>::impl(results, iterator);
-						if (iterator.getErrors().size() == 0) {
-							return value_type{ results };
-						} else {
-							return value_type{ null_type{} };
-						}
-					}
-					case 't':
-						return value_type{ bool_type{ true } };
-					case 'f': {
-						return value_type{ bool_type{ false } };
-					}
-					case 'n': {
-						return value_type{ null_type{} };
-					}
-					case '0':
-						[[fallthrough]];
-					case '1':
-						[[fallthrough]];
-					case '2':
-						[[fallthrough]];
-					case '3':
-						[[fallthrough]];
-					case '4':
-						[[fallthrough]];
-					case '5':
-						[[fallthrough]];
-					case '6':
-						[[fallthrough]];
-					case '7':
-						[[fallthrough]];
-					case '8':
-						[[fallthrough]];
-					case '9':
-						[[fallthrough]];
-					case '-': {
-						return value_type{ number_type{ jsonDataNew } };
-					}
-					default: {
-						return value_type{ null_type{} };
-					}
-				}
-			} else {
-				return value_type{ null_type{} };
+		std::shared_ptr<const internal::raw_json_storage> storage{};
+		uint32_t index{};
+	};
+
+	class raw_json_object_view {
+	  public:
+		class iterator {
+		  public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type		= std::pair<string_view, raw_json_data>;
+			using difference_type	= std::ptrdiff_t;
+			using reference			= value_type;
+
+			inline iterator() noexcept = default;
+
+			inline iterator(const std::shared_ptr<const internal::raw_json_storage>* storageNew, uint32_t keyNew) noexcept : storage{ storageNew }, key{ keyNew } {
+			}
+
+			inline value_type operator*() const noexcept {
+				return { (*storage)->key(key), raw_json_data{ *storage, key + 1 } };
+			}
+
+			inline iterator& operator++() noexcept {
+				key = (*storage)->nodes[key + 1].next;
+				return *this;
+			}
+
+			inline iterator operator++(int) noexcept {
+				iterator temp{ *this };
+				++*this;
+				return temp;
+			}
+
+			inline bool operator==(const iterator& other) const noexcept {
+				return key == other.key;
 			}
+
+		  protected:
+			const std::shared_ptr<const internal::raw_json_storage>* storage{};
+			uint32_t key{};
+		};
+
+		inline raw_json_object_view() noexcept = default;
+
+		inline raw_json_object_view(std::shared_ptr<const internal::raw_json_storage> storageNew, uint32_t indexNew) noexcept
+			: storage{ internal::move(storageNew) }, index{ indexNew } {
 		}
+
+		inline iterator begin() const noexcept {
+			return storage ? iterator{ &storage, index + 1 } : iterator{};
+		}
+
+		inline iterator end() const noexcept {
+			return storage ? iterator{ &storage, storage->nodes[index].next } : iterator{};
+		}
+
+		inline iterator find(string_view keyNew) const noexcept {
+			if (!storage) {
+				return end();
+			}
+			const auto& node		= storage->nodes[index];
+			const uint32_t* members = storage->elements.data() + node.children;
+			const auto matcher		= [&](uint64_t position) {
+				return storage->key(members[position]) == keyNew;
+			};
+			const uint64_t position = node.count >= internal::flat_key_index::hashThreshold
+				? internal::flat_key_index::probe(storage->keySlots.data() + node.slots, internal::flat_key_index::slotCount(node.count),
+					  internal::flat_key_index::hash(keyNew.data(), keyNew.size()), node.count, matcher)
+				: internal::flat_key_index::scan(storage->keyTags.data() + node.children, node.count, internal::flat_key_index::tag(keyNew.data(), keyNew.size()), matcher);
+			return position < node.count ? iterator{ &storage, members[position] } : end();
+		}
+
+		inline raw_json_data operator[](string_view keyNew) const noexcept {
+			const auto iter = find(keyNew);
+			return iter != end() ? (*iter).second : raw_json_data{};
+		}
+
+		inline bool contains(string_view keyNew) const noexcept {
+			return find(keyNew) != end();
+		}
+
+		inline uint64_t size() const noexcept {
+			return storage ? storage->nodes[index].count : 0;
+		}
+
+		inline bool empty() const noexcept {
+			return size() == 0;
+		}
+
+	  protected:
+		std::shared_ptr<const internal::raw_json_storage> storage{};
+		uint32_t index{};
 	};
 
+	inline raw_json_object_view raw_json_data::getObject() const noexcept {
+		return getType() == json_type::object ? object_type{ storage, index } : object_type{};
+	}
+
+	inline raw_json_array_view raw_json_data::getArray() const noexcept {
+		return getType() == json_type::array ? array_type{ storage, index } : array_type{};
+	}
+
+	template<std::integral index_type> inline raw_json_data raw_json_data::operator[](index_type indexNew) const noexcept {
+		return getArray()[static_cast<uint64_t>(indexNew)];
+	}
+
+	template<std::convertible_to<string_view> key_type> inline raw_json_data raw_json_data::operator[](key_type&& key) const noexcept {
+		return getObject()[string_view{ key }];
+	}
+
+	template<std::convertible_to<string_view> key_type> inline bool raw_json_data::contains(key_type&& key) const noexcept {
+		return getObject().contains(string_view{ key });
+	}
+
 	inline static std::ostream& operator<<(std::ostream& os, const raw_json_data& jsonValue) noexcept {
 		os << jsonValue.rawJson();
 		return os;
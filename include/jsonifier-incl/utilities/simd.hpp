@@ -71,6 +71,58 @@ namespace jsonifier::internal {
 		uint64_t index{};
 	};
 
+	struct minified_detector {
+		JSONIFIER_INLINE static bool impl(string_view_ptr data, uint64_t length) noexcept {
+			if JSONIFIER_UNLIKELY (length == 0) {
+				return true;
+			}
+			if JSONIFIER_UNLIKELY (whitespaceTable[static_cast<uint8_t>(data[length - 1])]) {
+				return false;
+			}
+			JSONIFIER_ALIGN(simdBytesPerRegister) uint8_t block[64];
+			const uint64_t blockLength = length < 64 ? length : 64;
+			std::memcpy(block, data, blockLength);
+			std::memset(block + blockLength, '0', 64 - blockLength);
+			simd_array_t inVals;
+			inVals.template set<0>(simd::gatherValues<jsonifier_simd_int_t>(block));
+			if constexpr (registersPerBlock > 1) {
+				inVals.template set<1>(simd::gatherValues<jsonifier_simd_int_t>(block + simdBytesPerRegister * 1));
+				if constexpr (registersPerBlock > 2) {
+					inVals.template set<2>(simd::gatherValues<jsonifier_simd_int_t>(block + simdBytesPerRegister * 2));
+					inVals.template set<3>(simd::gatherValues<jsonifier_simd_int_t>(block + simdBytesPerRegister * 3));
+				}
+			}
+			const jsonifier_simd_int_t opTable				= simd::gatherValues<jsonifier_simd_int_t>(simd::opArray<simdBytesPerRegister>.data());
+			const jsonifier_simd_int_t spaceMask			= simd::gatherValue<jsonifier_simd_int_t>(static_cast<char>(0x20));
+			const jsonifier_simd_int_t whitespaceTableLocal = simd::gatherValues<jsonifier_simd_int_t>(simd::whitespaceArray<simdBytesPerRegister>.data());
+			const uint64_t whitespace						= simd::ws_collector::impl(inVals, whitespaceTableLocal);
+			const uint64_t op								= simd::op_collector::impl(inVals, opTable, spaceMask);
+			return (whitespace & ((op << 1) | (op >> 1) | 1ULL)) == 0;
+		}
+
+		JSONIFIER_INLINE static bool rejectedByWhitespace(string_view_ptr data, uint64_t length, uint64_t errorIndex) noexcept {
+			const uint64_t start = errorIndex > 0 ? errorIndex - 1 : 0;
+			const uint64_t end	 = errorIndex + 2 < length ? errorIndex + 2 : length;
+			for (uint64_t x = start; x < end; ++x) {
+				if (whitespaceTable[static_cast<uint8_t>(data[x])]) {
+					return true;
+				}
+			}
+			return false;
+		}
+	};
+
+	template<char value> JSONIFIER_INLINE static uint64_t collectByteMask(string_view_ptr data) noexcept {
+		const jsonifier_simd_int_t valueRegister = simd::gatherValue<jsonifier_simd_int_t>(value);
+		uint64_t mask{};
+		[&]<uint64_t... indices>(integer_sequence<indices...>) {
+			((mask |= static_cast<uint64_t>(simd::opCmpEqBitMask(simd::gatherValuesU<jsonifier_simd_int_t>(data + indices * simdBytesPerRegister), valueRegister))
+					<< (indices * simdBytesPerRegister)),
+				...);
+		}(make_integer_sequence<registersPerBlock>{});
+		return mask;
+	}
+
 	inline static void printBitsAligned(uint64_t bits, const char* label, const char* str = nullptr, uint64_t len = 0) noexcept {
 		std::cout << label << ":" << std::endl;
 		if (str && len > 0) {
@@ -229,4 +229,92 @@ namespace jsonifier::internal {
 		to_float(negative, am, value);
 		return iter;
 	}
+
+	template<typename value_type> struct batch_number_parser {
+		static constexpr uint64_t powersOfTen[]{ 1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL };
+		static constexpr uint64_t maxDigits{ concepts::int_types<value_type> ? 18 : 19 };
+		static constexpr int64_t minimumSpan{ 64 };
+
+		JSONIFIER_INLINE static uint64_t digitRunLength(const uint64_t val) noexcept {
+			const uint64_t nonDigits{ ((val + 0x7676767676767676ULL) | val) & 0x8080808080808080ULL };
+			return nonDigits ? static_cast<uint64_t>(std::countr_zero(nonDigits)) >> 3 : 8;
+		}
+
+		JSONIFIER_INLINE static string_view_ptr parseDigits(uint64_t& mantissa, uint64_t& digitCount, string_view_ptr iter) noexcept {
+			uint64_t length;
+			do {
+				const uint64_t val{ read8_to_u64(iter) - 0x3030303030303030ULL };
+				length = digitRunLength(val);
+				if (length > 0) {
+					mantissa = mantissa * powersOfTen[length] + parse_eight_digits_unrolled_no_sub(val << ((8 - length) * 8));
+					digitCount += length;
+					iter += length;
+				}
+			} while (length == 8 && digitCount <= maxDigits);
+			return iter;
+		}
+
+		JSONIFIER_INLINE static string_view_ptr impl(value_type& value, string_view_ptr iter, string_view_ptr end) noexcept {
+			if constexpr (std::endian::native != std::endian::little) {
+				return nullptr;
+			}
+			if JSONIFIER_UNLIKELY (end - iter < minimumSpan) {
+				return nullptr;
+			}
+			const bool negative{ *iter == minus };
+			iter += negative;
+			const string_view_ptr integerStart{ iter };
+			uint64_t mantissa{};
+			uint64_t digitCount{};
+			iter = parseDigits(mantissa, digitCount, iter);
+			if JSONIFIER_UNLIKELY (digitCount == 0 || digitCount > maxDigits || (*integerStart == zero && digitCount > 1)) {
+				return nullptr;
+			}
+			if constexpr (concepts::integer_t<value_type>) {
+				if JSONIFIER_UNLIKELY ((concepts::uint_types<value_type> && negative) || *iter == decimal || exp_tables<>::expTable[static_cast<uint8_t>(*iter)]) {
+					return nullptr;
+				}
+				value = negative ? static_cast<value_type>(-static_cast<int64_t>(mantissa)) : static_cast<value_type>(mantissa);
+				return iter;
+			} else {
+				int64_t exponent{};
+				if (*iter == decimal) {
+					const string_view_ptr fractionStart{ ++iter };
+					iter	 = parseDigits(mantissa, digitCount, iter);
+					exponent = fractionStart - iter;
+					if JSONIFIER_UNLIKELY (exponent == 0 || digitCount > maxDigits) {
+						return nullptr;
+					}
+				}
+				if (exp_tables<>::expTable[static_cast<uint8_t>(*iter)]) {
+					++iter;
+					const bool negativeExponent{ *iter == minus };
+					iter += negativeExponent || *iter == plus;
+					int64_t expNumber{};
+					const string_view_ptr exponentStart{ iter };
+					while (JSONIFIER_IS_DIGIT(*iter) && iter - exponentStart < 4) {
+						expNumber = expNumber * 10 + static_cast<uint8_t>(*iter - zero);
+						++iter;
+					}
+					if JSONIFIER_UNLIKELY (iter == exponentStart || JSONIFIER_IS_DIGIT(*iter)) {
+						return nullptr;
+					}
+					exponent += negativeExponent ? -expNumber : expNumber;
+				}
+				if (binary_format<value_type>::min_exponent_fast_path <= exponent && exponent <= binary_format<value_type>::max_exponent_fast_path &&
+					mantissa <= binary_format<value_type>::max_mantissa_fast_path_value && rounds_to_nearest::roundsToNearest) {
+					value = static_cast<value_type>(mantissa);
+					value = exponent < 0 ? value / binary_format<value_type>::exact_power_of_ten(-exponent) : value * binary_format<value_type>::exact_power_of_ten(exponent);
+					value = negative ? -value : value;
+					return iter;
+				}
+				adjusted_mantissa am = compute_float<binary_format<value_type>>(exponent, mantissa);
+				if JSONIFIER_UNLIKELY (am.power2 < 0 || am.power2 == binary_format<value_type>::infinite_power) {
+					return nullptr;
+				}
+				to_float(negative, am, value);
+				return iter;
+			}
+		}
+	};
 }
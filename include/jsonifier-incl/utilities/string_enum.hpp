@@ -0,0 +1,96 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+/// https://github.com/RealTimeChris/jsonifier
+
+#pragma once
+
+#include <jsonifier-incl/core/core.hpp>
+#include <jsonifier-incl/utilities/json_entity.hpp>
+
+namespace jsonifier::internal {
+
+	template<typename value_type, uint64_t index> static constexpr auto quotedEnumName{ string_literal{ "\"" } +
+		remove_cvref_t<decltype(getBecauseOtherLibAuthorsResolve<index>(core<value_type>::enumValue))>::name + string_literal{ "\"" } };
+
+	template<typename value_type> struct string_enum_data {
+		using underlying_type = std::underlying_type_t<value_type>;
+
+		static constexpr uint64_t count{ tuple_size_v<decltype(core<value_type>::enumValue)> };
+
+		template<uint64_t... indices> static constexpr array<value_type, count> collectValues(integer_sequence<indices...>) noexcept {
+			return { { remove_cvref_t<decltype(getBecauseOtherLibAuthorsResolve<indices>(core<value_type>::enumValue))>::value... } };
+		}
+
+		template<uint64_t... indices> static constexpr array<string_view, count> collectQuotedNames(integer_sequence<indices...>) noexcept {
+			return { { quotedEnumName<value_type, indices>.operator string_view()... } };
+		}
+
+		static constexpr array<value_type, count> values{ collectValues(make_integer_sequence<count>{}) };
+		static constexpr array<string_view, count> quotedNames{ collectQuotedNames(make_integer_sequence<count>{}) };
+
+		static constexpr int64_t minValue{ [] {
+			int64_t result{ std::numeric_limits<int64_t>::max() };
+			for (uint64_t x = 0; x < count; ++x) {
+				result = static_cast<int64_t>(values[x]) < result ? static_cast<int64_t>(values[x]) : result;
+			}
+			return result;
+		}() };
+
+		static constexpr uint64_t range{ [] {
+			uint64_t result{};
+			for (uint64_t x = 0; x < count; ++x) {
+				const auto offset = static_cast<uint64_t>(static_cast<int64_t>(values[x]) - minValue);
+				result			  = offset + 1 > result ? offset + 1 : result;
+			}
+			return result;
+		}() };
+
+		static constexpr bool dense{ range <= count * 4 + 16 };
+
+		static constexpr auto denseIndices{ [] {
+			array<uint16_t, dense ? range : 1> result{};
+			if constexpr (dense) {
+				std::fill(result.data(), result.data() + result.size(), static_cast<uint16_t>(count));
+				for (uint64_t x = 0; x < count; ++x) {
+					result[static_cast<uint64_t>(static_cast<int64_t>(values[x]) - minValue)] = static_cast<uint16_t>(x);
+				}
+			}
+			return result;
+		}() };
+
+		JSONIFIER_INLINE static uint64_t indexOf(value_type value) noexcept {
+			if constexpr (dense) {
+				const auto offset = static_cast<uint64_t>(static_cast<int64_t>(value) - minValue);
+				return offset < range ? denseIndices[offset] : count;
+			} else {
+				for (uint64_t x = 0; x < count; ++x) {
+					if (values[x] == value) {
+						return x;
+					}
+				}
+				return count;
+			}
+		}
+	};
+
+}
@@ -605,6 +605,55 @@ namespace jsonifier::internal {
 		}
 	};
 
+	template<typename basic_iterator01> struct string_measurer {
+		struct string_measure_step {
+			template<uint64_t index> JSONIFIER_INLINE static auto* impl(basic_iterator01& string1Start, const basic_iterator01 string1End, uint64_t& length) noexcept {
+				using simd_list_local					 = type_list_element_t<index, simd::avx_integer_list>;
+				using integer_type						 = typename simd_list_local::integer_type;
+				using simd_type							 = typename simd_list_local::type::type;
+				static constexpr uint64_t bytesProcessed = simd_list_local::bytesProcessed;
+				static constexpr integer_type mask		 = simd_list_local::mask;
+
+				simd_type simdValue;
+				integer_type nextEscapeable;
+				const auto stringEndNew = string1End - bytesProcessed;
+
+				const simd_type simdValues01 = simd::gatherValue<simd_type>('"');
+				const simd_type simdValues02 = simd::gatherValue<simd_type>('\\');
+				const simd_type simdValues03 = simd::gatherValue<simd_type>(static_cast<char>(32));
+				while (string1Start < stringEndNew) {
+					simdValue	   = simd::gatherValuesU<simd_type>(string1Start);
+					nextEscapeable = findSerialize<simd_type, integer_type>(simdValue, simdValues01, simdValues02, simdValues03);
+					if JSONIFIER_LIKELY (nextEscapeable != mask) {
+						length += nextEscapeable + escapeTableSizes[static_cast<uint8_t>(string1Start[nextEscapeable])];
+						string1Start += nextEscapeable + 1;
+					} else {
+						length += bytesProcessed;
+						string1Start += bytesProcessed;
+					}
+				}
+				return string1Start;
+			}
+		};
+
+		JSONIFIER_INLINE static uint64_t shortImpl(basic_iterator01 string1Start, const basic_iterator01 string1End) noexcept {
+			uint64_t length{};
+			uint64_t escapeSize;
+			for (; string1Start < string1End; ++string1Start) {
+				escapeSize = escapeTableSizes[static_cast<uint8_t>(*string1Start)];
+				length += escapeSize > 0 ? escapeSize : 1;
+			}
+			return length;
+		}
+
+		JSONIFIER_INLINE static uint64_t impl(basic_iterator01 string1Start, uint64_t lengthNew) noexcept {
+			const basic_iterator01 string1End = string1Start + lengthNew;
+			uint64_t length{};
+			string_parse_executor<string_measure_step, make_ascending_range<start_index, list_size>>::impl(string1Start, string1End, length);
+			return length + shortImpl(string1Start, string1End);
+		}
+	};
+
 	template<string_literal string> static constexpr convert_length_to_int_t<string.size()> getStringAsInt() noexcept {
 		string_view_ptr stringNew = string.data();
 		convert_length_to_int_t<string.size()> returnValue{};
@@ -0,0 +1,166 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+/// https://github.com/RealTimeChris/jsonifier
+#pragma once
+
+#include "unit_tests.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace allocation_tests {
+
+	inline std::atomic<uint64_t> globalAllocations{};
+
+}
+
+#if JSONIFIER_COMPILER_GCC
+	#pragma GCC diagnostic push
+	#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+	allocation_tests::globalAllocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+		return ptr;
+	}
+	throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+	return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+#if JSONIFIER_COMPILER_GCC
+	#pragma GCC diagnostic pop
+#endif
+
+struct reuse_child {
+	std::string name{};
+	std::vector<double> values{};
+};
+
+template<> struct jsonifier::core<reuse_child> {
+	using value_type				 = reuse_child;
+	static constexpr auto parseValue = createValue<&value_type::name, &value_type::values>();
+};
+
+struct reuse_message {
+	std::string symbol{};
+	std::vector<std::string> tags{};
+	std::vector<reuse_child> children{};
+	std::optional<reuse_child> extra{};
+	std::unique_ptr<reuse_child> owned{};
+	std::map<std::string, int64_t> counts{};
+	std::variant<int64_t, std::string> tag{};
+};
+
+template<> struct jsonifier::core<reuse_message> {
+	using value_type = reuse_message;
+	static constexpr auto parseValue =
+		createValue<&value_type::symbol, &value_type::tags, &value_type::children, &value_type::extra, &value_type::owned, &value_type::counts, &value_type::tag>();
+};
+
+namespace allocation_tests {
+
+	inline static constexpr std::string_view reuseMessageJson{
+		R"({"symbol":"EURUSD","tags":["fx","spot","g10"],"children":[{"name":"bid","values":[1.0841,1.0842,1.0843]},{"name":"ask","values":[1.0844,1.0845]}],"extra":{"name":"mid","values":[1.08425]},"owned":{"name":"last","values":[1.0843,2.5]},"counts":{"bid":3,"ask":2},"tag":"snapshot"})"
+	};
+
+	struct allocation_snapshot {
+		uint64_t global{ globalAllocations.load(std::memory_order_relaxed) };
+		uint64_t internal{ jsonifier::internal::allocation_counter::allocations.load(std::memory_order_relaxed) };
+	};
+
+	template<bool partial, bool knownOrder, bool prettified> inline static void allocationTestsImpl() {
+		static constexpr jsonifier::parse_options opts{ .partialRead = partial, .knownOrder = knownOrder, .minified = !prettified, .reuseStorage = true };
+
+		auto test_reuse_zero_allocations = []() {
+			jsonifier::jsonifier_core<> parser{};
+			std::string json{ reuseMessageJson };
+			if constexpr (prettified) {
+				json = parser.prettifyJson(json);
+			}
+			reuse_message message{};
+			for (uint64_t x = 0; x < 2; ++x) {
+				parser.parseJson<opts>(message, json);
+				printErrors(parser);
+			}
+			allocation_snapshot before{};
+			bool succeeded{ true };
+			for (uint64_t x = 0; x < 64; ++x) {
+				succeeded &= parser.parseJson<opts>(message, json);
+			}
+			allocation_snapshot after{};
+			return std::make_tuple(succeeded, after.global - before.global, after.internal - before.internal, message.children.size(), message.children[1].values.size(),
+				message.owned->name, std::get<std::string>(message.tag));
+		};
+
+		auto test_reuse_shape_change = []() {
+			jsonifier::jsonifier_core<> parser{};
+			reuse_message message{};
+			std::string json{ reuseMessageJson };
+			parser.parseJson<opts>(message, json);
+			printErrors(parser);
+			std::string shrunk{ R"({"symbol":"GBPUSD","tags":["fx"],"children":[],"extra":null,"owned":{"name":"x","values":[1]},"counts":{"bid":9},"tag":7})" };
+			parser.parseJson<opts>(message, shrunk);
+			printErrors(parser);
+			return std::make_tuple(message.symbol, message.tags.size(), message.children.size(), message.extra.has_value(), message.owned->values.size(), message.counts["bid"],
+				std::get<int64_t>(message.tag));
+		};
+
+		std::cout << "Allocation Tests, " << testTypePartial<partial> << testTypeKnownOrder<knownOrder> << (prettified ? ", Prettified" : ", Minified") << ": " << std::endl;
+
+		rt_ut::unit_test<"Reuse Storage Zero Allocations", true>::assert_eq(
+			std::make_tuple(true, uint64_t{ 0 }, uint64_t{ 0 }, std::uint64_t{ 2 }, std::uint64_t{ 2 }, std::string{ "last" }, std::string{ "snapshot" }),
+			test_reuse_zero_allocations);
+		rt_ut::unit_test<"Reuse Storage Shape Change", true>::assert_eq(
+			std::make_tuple(std::string{ "GBPUSD" }, std::uint64_t{ 1 }, std::uint64_t{ 0 }, false, std::uint64_t{ 1 }, int64_t{ 9 }, int64_t{ 7 }), test_reuse_shape_change);
+	}
+
+	inline static void allocationTests() {
+		allocationTestsImpl<false, false, false>();
+		allocationTestsImpl<false, true, false>();
+		allocationTestsImpl<true, false, false>();
+		allocationTestsImpl<true, true, false>();
+		allocationTestsImpl<false, false, true>();
+		allocationTestsImpl<false, true, true>();
+		allocationTestsImpl<true, false, true>();
+		allocationTestsImpl<true, true, true>();
+	}
+
+}
@@ -0,0 +1,98 @@
+/*
+	MIT License
+
+	Copyright (c) 2024 RealTimeChris
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this
+	software and associated documentation files (the "Software"), to deal in the Software
+	without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+	persons to whom the Software is furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all copies or
+	substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+	PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+	DEALINGS IN THE SOFTWARE.
+*/
+
+#include "parsing_tests.hpp"
+#include <chrono>
+#include <iomanip>
+
+namespace read_route_benchmark {
+
+	static constexpr uint64_t iterationCount{ 50 };
+	static constexpr uint64_t repetitionCount{ 9 };
+
+	template<jsonifier::parse_options options, typename value_type> inline static double measure(jsonifier::jsonifier_core<>& parser, const std::string& data) {
+		value_type value{};
+		for (uint64_t x = 0; x < iterationCount; ++x) {
+			parser.parseJson<options>(value, data);
+		}
+		double best{ std::numeric_limits<double>::max() };
+		for (uint64_t x = 0; x < repetitionCount; ++x) {
+			auto start = std::chrono::steady_clock::now();
+			for (uint64_t y = 0; y < iterationCount; ++y) {
+				parser.parseJson<options>(value, data);
+			}
+			auto end = std::chrono::steady_clock::now();
+			best	 = std::min(best, std::chrono::duration<double, std::micro>(end - start).count() / static_cast<double>(iterationCount));
+		}
+		return best;
+	}
+
+	template<rt_ut::string_literal testName, typename value_type, bool prettified> inline static void runBenchmark(jsonifier::jsonifier_core<>& parser) {
+		static constexpr jsonifier::parse_options singlePassOpts{ .minified = !prettified };
+		static constexpr jsonifier::parse_options twoStageOpts{ .partialRead = true, .minified = !prettified };
+		static constexpr jsonifier::parse_options adaptiveOpts{ .minified = !prettified, .adaptiveRead = true };
+		auto data = file_handle::get(basePath.operator std::string() + "/json/" + testName.operator std::string() + ".json");
+		if (data.empty()) {
+			return;
+		}
+		const double singlePass = measure<singlePassOpts, value_type>(parser, data);
+		const double twoStage	= measure<twoStageOpts, value_type>(parser, data);
+		const double adaptive	= measure<adaptiveOpts, value_type>(parser, data);
+		const double skipRatio	= static_cast<double>(jsonifier::internal::read_route<value_type, adaptiveOpts>::skipRatio()) /
+			static_cast<double>(jsonifier::internal::read_route<value_type, adaptiveOpts>::ratioScale);
+		std::cout << std::left << std::setw(46) << testName.operator std::string() << std::right << std::setw(10) << data.size() << std::setw(9) << std::fixed
+				  << std::setprecision(2) << skipRatio << std::setw(14) << singlePass << std::setw(14) << twoStage << std::setw(14) << adaptive << "  "
+				  << (parser.usesTwoStageRead<value_type, adaptiveOpts>(data.size()) ? "two-stage" : "single-pass") << std::endl;
+	}
+
+	inline static void readRouteBenchmark() {
+		jsonifier::jsonifier_core<> parser{};
+		std::cout << std::left << std::setw(46) << "Corpus" << std::right << std::setw(10) << "Bytes" << std::setw(9) << "Skip" << std::setw(14) << "Single (us)"
+				  << std::setw(14) << "Two (us)" << std::setw(14) << "Adaptive (us)" << "  Route" << std::endl;
+		runBenchmark<"Abc (In Order) Partial Test (Minified)", abc_in_order_partial_test, false>(parser);
+		runBenchmark<"Abc (In Order) Partial Test (Prettified)", abc_in_order_partial_test, true>(parser);
+		runBenchmark<"Abc (In Order) Test (Minified)", abc_in_order_test, false>(parser);
+		runBenchmark<"Abc (In Order) Test (Prettified)", abc_in_order_test, true>(parser);
+		runBenchmark<"Abc (Out of Order) Partial Test (Minified)", abc_out_of_order_partial_test, false>(parser);
+		runBenchmark<"Abc (Out of Order) Partial Test (Prettified)", abc_out_of_order_partial_test, true>(parser);
+		runBenchmark<"Apache Builds Test (Minified)", apache_builds_message, false>(parser);
+		runBenchmark<"CitmCatalog Test (Minified)", citm_catalog_message, false>(parser);
+		runBenchmark<"CitmCatalog Test (Prettified)", citm_catalog_message, true>(parser);
+		runBenchmark<"Discord Test (Minified)", discord_message, false>(parser);
+		runBenchmark<"Github Events Test (Minified)", github_events_message, false>(parser);
+		runBenchmark<"Google Maps Response Test (Minified)", google_maps_response_message, false>(parser);
+		runBenchmark<"Instruments Test (Minified)", instruments_message, false>(parser);
+		runBenchmark<"Mesh Test (Minified)", mesh_message, false>(parser);
+		runBenchmark<"Random Test (Minified)", random_message, false>(parser);
+		runBenchmark<"Twitter Partial Test (Minified)", twitter_partial_message, false>(parser);
+		runBenchmark<"Twitter Partial Test (Prettified)", twitter_partial_message, true>(parser);
+		runBenchmark<"Twitter Test (Minified)", twitter_message, false>(parser);
+		runBenchmark<"Twitter Test (Prettified)", twitter_message, true>(parser);
+	}
+
+}
+
+int main() {
+	std::cout << "Current active CPU backend: " << jsonifier::cpu_arch_name << std::endl;
+	read_route_benchmark::readRouteBenchmark();
+	return 0;
+}
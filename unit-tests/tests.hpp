@@ -23,6 +23,7 @@
 #pragma once
 
 #include "utf8_validation.hpp"
+#include "allocation_tests.hpp"
 #include "parsing_tests.hpp"
 #include "conformance.hpp"
 #include "bounds_test.hpp"
@@ -46,6 +47,7 @@ namespace tests {
 		uint_validation_tests::uintTests();
 		int_validation_tests::intTests();
 		unit_tests::unitTests();
+		allocation_tests::allocationTests();
 	};
 
 }
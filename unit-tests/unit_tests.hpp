@@ -23,6 +23,7 @@
 #pragma once
 
 #include "common.hpp"
+#include <thread>
 
 enum class Color : uint8_t { Red, Green, Blue };
 
@@ -275,6 +276,167 @@ template<> struct jsonifier::core<DummyDataVec> {
 	static constexpr auto parseValue = createValue<&value_type::items>();
 };
 
+struct key_order_struct {
+	int32_t a{};
+	int32_t b{};
+	int32_t c{};
+};
+
+template<> struct jsonifier::core<key_order_struct> {
+	using value_type				 = key_order_struct;
+	static constexpr auto parseValue = createValue<&value_type::a, &value_type::b, &value_type::c>();
+};
+
+struct read_route_struct {
+	int32_t id{};
+	std::string name{};
+};
+
+template<> struct jsonifier::core<read_route_struct> {
+	using value_type				 = read_route_struct;
+	static constexpr auto parseValue = createValue<&value_type::id, &value_type::name>();
+};
+
+struct raw_envelope {
+	std::string type{};
+	jsonifier::raw_json_data payload{};
+};
+
+template<> struct jsonifier::core<raw_envelope> {
+	using value_type				 = raw_envelope;
+	static constexpr auto parseValue = createValue<&value_type::type, &value_type::payload>();
+};
+
+struct interned_event {
+	jsonifier::interned_string type{};
+	jsonifier::interned_string repo{};
+};
+
+template<> struct jsonifier::core<interned_event> {
+	using value_type				 = interned_event;
+	static constexpr auto parseValue = createValue<&value_type::type, &value_type::repo>();
+};
+
+enum class event_kind : uint8_t { push_event, pull_request_event = 4, issue_event = 9, watch_event = 10 };
+
+template<> struct jsonifier::core<event_kind> {
+	static constexpr auto enumValue = createEnum<makeEnumEntity<event_kind::push_event, "PushEvent">(), makeEnumEntity<event_kind::pull_request_event, "PullRequestEvent">(),
+		makeEnumEntity<event_kind::issue_event, "IssueEvent">(), event_kind::watch_event>();
+};
+
+struct kind_event {
+	event_kind kind{};
+	std::vector<event_kind> history{};
+};
+
+template<> struct jsonifier::core<kind_event> {
+	using value_type				 = kind_event;
+	static constexpr auto parseValue = createValue<&value_type::kind, &value_type::history>();
+};
+
+struct push_payload {
+	std::string type{};
+	std::string ref{};
+	int32_t size{};
+};
+
+template<> struct jsonifier::core<push_payload> {
+	using value_type				 = push_payload;
+	static constexpr auto parseValue = createValue<&value_type::type, &value_type::ref, &value_type::size>();
+};
+
+struct issue_payload {
+	std::string type{};
+	int64_t number{};
+	std::string title{};
+};
+
+template<> struct jsonifier::core<issue_payload> {
+	using value_type				 = issue_payload;
+	static constexpr auto parseValue = createValue<&value_type::type, &value_type::number, &value_type::title>();
+};
+
+struct watch_payload {
+	std::string type{};
+	std::string action{};
+};
+
+template<> struct jsonifier::core<watch_payload> {
+	using value_type				 = watch_payload;
+	static constexpr auto parseValue = createValue<&value_type::type, &value_type::action>();
+};
+
+using tagged_payload = std::variant<push_payload, issue_payload, watch_payload>;
+
+template<> struct jsonifier::core<tagged_payload> {
+	static constexpr std::string_view tagKey{ "type" };
+	static constexpr auto variantTags = createVariantTags<"PushEvent", "IssueEvent", "WatchEvent">();
+};
+
+using inferred_payload = std::variant<watch_payload, push_payload, issue_payload, std::string>;
+
+struct cached_state {
+	int32_t tick{};
+	jsonifier::cached<std::vector<int32_t>> history{};
+	jsonifier::cached<sub_thing> detail{};
+};
+
+template<> struct jsonifier::core<cached_state> {
+	using value_type				 = cached_state;
+	static constexpr auto parseValue = createValue<&value_type::tick, &value_type::history, &value_type::detail>();
+};
+
+struct plain_state {
+	int32_t tick{};
+	std::vector<int32_t> history{};
+	sub_thing detail{};
+};
+
+template<> struct jsonifier::core<plain_state> {
+	using value_type				 = plain_state;
+	static constexpr auto parseValue = createValue<&value_type::tick, &value_type::history, &value_type::detail>();
+};
+
+struct fragment_envelope {
+	std::string type{};
+	jsonifier::json_fragment payload{};
+};
+
+template<> struct jsonifier::core<fragment_envelope> {
+	using value_type				 = fragment_envelope;
+	static constexpr auto parseValue = createValue<&value_type::type, &value_type::payload>();
+};
+
+enum class tick_side : uint8_t { bid, ask };
+
+struct market_tick {
+	int64_t timestamp{};
+	uint32_t venue{};
+	double price{};
+	float size{};
+	int32_t delta{};
+	bool active{};
+	char flag{};
+	tick_side side{};
+};
+
+template<> struct jsonifier::core<market_tick> {
+	using value_type				 = market_tick;
+	static constexpr auto parseValue = createValue<&value_type::timestamp, &value_type::venue, &value_type::price, &value_type::size, &value_type::delta,
+		&value_type::active, &value_type::flag, &value_type::side>();
+};
+
+struct numeric_series {
+	std::vector<double> values{};
+	std::vector<int64_t> stamps{};
+	std::vector<uint64_t> ids{};
+};
+
+template<> struct jsonifier::core<numeric_series> {
+	using value_type				 = numeric_series;
+	static constexpr auto parseValue = createValue<&value_type::values, &value_type::stamps, &value_type::ids>();
+};
+
 template<typename parser_type> void printErrors(parser_type& parser) {
 	for (auto& error: parser.getErrors()) {
 		std::cout << error << std::endl;
@@ -1044,6 +1206,666 @@ namespace unit_tests {
 			return std::make_tuple(parsed.size(), parsed[1].b == TestData::A);
 		};
 
+		auto test_shared_key_order_learning = []() {
+			static constexpr jsonifier::parse_options sharedOpts{ .partialRead = partial, .knownOrder = knownOrder, .sharedKeyOrder = true };
+			jsonifier::jsonifier_core<> parser{};
+			const bool reset = parser.loadKeyOrder<key_order_struct, sharedOpts>(jsonifier::key_order_profile{ { "a", "b", "c" } });
+			key_order_struct parsed{};
+			std::thread worker{ [&parsed] {
+				jsonifier::jsonifier_core<> workerParser{};
+				std::string json = R"({"c":3,"a":1,"b":2})";
+				workerParser.parseJson<sharedOpts>(parsed, json);
+				printErrors(workerParser);
+			} };
+			worker.join();
+			const auto shared	   = parser.dumpKeyOrder<key_order_struct, sharedOpts>();
+			const auto threadLocal = parser.dumpKeyOrder<key_order_struct, opts>();
+			const bool sharedLearned =
+				knownOrder ? shared.keys == std::vector<jsonifier::string>{ "c", "a", "b" } : shared.keys == std::vector<jsonifier::string>{ "a", "b", "c" };
+			return std::make_tuple(reset, parsed.a, parsed.b, parsed.c, sharedLearned, threadLocal.keys == std::vector<jsonifier::string>{ "a", "b", "c" });
+		};
+
+		auto test_shared_key_order_profile = []() {
+			static constexpr jsonifier::parse_options sharedOpts{ .partialRead = partial, .knownOrder = knownOrder, .sharedKeyOrder = true };
+			jsonifier::jsonifier_core<> parser{};
+			std::string serialized{};
+			parser.serializeJson(jsonifier::key_order_profile{ { "c", "a", "b" } }, serialized);
+			jsonifier::key_order_profile profile{};
+			parser.parseJson(profile, serialized);
+			const bool loaded	= parser.loadKeyOrder<key_order_struct, sharedOpts>(profile);
+			const bool rejected = !parser.loadKeyOrder<key_order_struct, sharedOpts>(jsonifier::key_order_profile{ { "c", "a", "d" } }) &&
+				!parser.loadKeyOrder<key_order_struct, sharedOpts>(jsonifier::key_order_profile{ { "c", "a" } });
+			key_order_struct outOfOrder{};
+			std::string json = R"({"c":3,"a":1,"b":2})";
+			parser.parseJson<sharedOpts>(outOfOrder, json);
+			printErrors(parser);
+			key_order_struct inOrder{};
+			json = R"({"a":4,"b":5,"c":6})";
+			parser.parseJson<sharedOpts>(inOrder, json);
+			printErrors(parser);
+			return std::make_tuple(serialized, loaded, rejected, outOfOrder.a + outOfOrder.b * 10 + outOfOrder.c * 100, inOrder.a + inOrder.b * 10 + inOrder.c * 100);
+		};
+
+		auto test_prettified_layout = []() {
+			jsonifier::jsonifier_core<> parser{};
+			nested_struct obj{};
+			obj.inner	= { 12, "indented", 1.5 };
+			obj.numbers = { 3, 4, 5 };
+			obj.flag	= true;
+			std::string json{};
+			parser.serializeJson<jsonifier::serialize_options{ .prettify = true }>(obj, json);
+			nested_struct parsed{};
+			parser.parseJson<opts>(parsed, json);
+			printErrors(parser);
+			parser.parseJson<opts>(parsed, json);
+			printErrors(parser);
+			std::string irregular = "{\n  \"inner\": {\"id\": 7,\n\t\"name\" : \"mixed\",   \"value\":2.5},\n    \"numbers\": [1],\"flag\"\n:\ntrue\n}";
+			nested_struct mixed{};
+			parser.parseJson<opts>(mixed, irregular);
+			printErrors(parser);
+			return std::make_tuple(parsed.inner.id, parsed.inner.name, parsed.numbers.size(), parsed.flag, mixed.inner.id, mixed.inner.name, mixed.inner.value, mixed.numbers[0],
+				mixed.flag);
+		};
+
+		auto test_detect_minified = []() {
+			static constexpr jsonifier::parse_options detectOpts{ .partialRead = partial, .knownOrder = knownOrder, .detectMinified = true };
+			jsonifier::jsonifier_core<> parser{};
+			nested_struct obj{};
+			obj.inner	= { 21, "detected", 4.25 };
+			obj.numbers = { 9, 8, 7, 6 };
+			obj.flag	= true;
+			std::string minified{};
+			parser.serializeJson(obj, minified);
+			std::string prettified{};
+			parser.serializeJson<jsonifier::serialize_options{ .prettify = true }>(obj, prettified);
+			std::string lateWhitespace{ minified };
+			lateWhitespace.insert(lateWhitespace.find("\"flag\""), std::string(80, ' '));
+			nested_struct fromMinified{};
+			nested_struct fromPrettified{};
+			nested_struct fromLateWhitespace{};
+			const bool minifiedOk = parser.parseJson<detectOpts>(fromMinified, minified);
+			printErrors(parser);
+			const bool prettifiedOk = parser.parseJson<detectOpts>(fromPrettified, prettified);
+			printErrors(parser);
+			const bool lateWhitespaceOk = parser.parseJson<detectOpts>(fromLateWhitespace, lateWhitespace);
+			printErrors(parser);
+			const bool detected = jsonifier::internal::minified_detector::impl(minified.data(), minified.size()) &&
+				!jsonifier::internal::minified_detector::impl(prettified.data(), prettified.size()) &&
+				jsonifier::internal::minified_detector::impl(lateWhitespace.data(), lateWhitespace.size());
+			static constexpr jsonifier::parse_options minifiedOpts{ .partialRead = partial, .knownOrder = knownOrder, .minified = true };
+			std::string malformed{ minified };
+			malformed.erase(malformed.find(':', malformed.find("\"numbers\"")), 1);
+			nested_struct fromMalformed{};
+			const bool malformedRejected = !parser.parseJson<detectOpts>(fromMalformed, malformed);
+			const std::vector<jsonifier::internal::error> detectErrors{ parser.getErrors() };
+			parser.parseJson<minifiedOpts>(fromMalformed, malformed);
+			const bool firstPassErrors = malformedRejected && detectErrors.size() == parser.getErrors().size() && !detectErrors.empty() &&
+				std::string_view{ detectErrors.front().getSourceLocation().function_name() } == parser.getErrors().front().getSourceLocation().function_name();
+			return std::make_tuple(detected, minifiedOk && prettifiedOk && lateWhitespaceOk, fromMinified.inner.name, fromPrettified.numbers.size(), fromLateWhitespace.flag,
+				firstPassErrors);
+		};
+
+		auto test_adaptive_read = []() {
+			static constexpr jsonifier::parse_options adaptiveOpts{ .partialRead = partial, .knownOrder = knownOrder, .adaptiveRead = true };
+			jsonifier::jsonifier_core<> parser{};
+			std::string sparse{ "{\"payload\":\"" + std::string(32768, 'x') + "\",\"id\":17,\"tags\":[1,2,3]}" };
+			std::string dense{ "{\"id\":23}" };
+			read_route_struct fromSparse{};
+			read_route_struct fromDense{};
+			bool parsedOk{ true };
+			for (uint64_t x = 0; x < 8; ++x) {
+				parsedOk &= parser.parseJson<adaptiveOpts>(fromSparse, sparse);
+				printErrors(parser);
+			}
+			static constexpr jsonifier::parse_options minifiedAdaptiveOpts{ .partialRead = partial, .knownOrder = knownOrder, .minified = true, .adaptiveRead = true };
+			const bool learnedTwoStage = parser.usesTwoStageRead<read_route_struct, adaptiveOpts>(sparse.size()) &&
+				!parser.usesTwoStageRead<read_route_struct, minifiedAdaptiveOpts>(sparse.size());
+			parsedOk &= parser.parseJson<adaptiveOpts>(fromSparse, sparse);
+			printErrors(parser);
+			parsedOk &= parser.parseJson<adaptiveOpts>(fromDense, dense);
+			printErrors(parser);
+			const bool smallSinglePass = !parser.usesTwoStageRead<read_route_struct, adaptiveOpts>(dense.size());
+			std::string largeName{ "{\"name\":\"" + std::string(3 * 1024 * 1024, 'y') + "\",\"id\":5}" };
+			read_route_struct fromLarge{};
+			parsedOk &= parser.parseJson<adaptiveOpts>(fromLarge, largeName);
+			printErrors(parser);
+			return std::make_tuple(parsedOk, fromSparse.id, fromDense.id, learnedTwoStage, smallSinglePass, fromLarge.name.size() == 3 * 1024 * 1024 && fromLarge.id == 5);
+		};
+
+		auto test_raw_json_views = []() {
+			jsonifier::jsonifier_core<> parser{};
+			std::string json{ R"({"type":"event","payload":{ "id": 42, "name": "a\"b", "tags": ["x", "y", "z"], "nested": {"deep": [1.5, true, null]} }})" };
+			raw_envelope envelope{};
+			bool parsedOk = parser.parseJson<opts>(envelope, json);
+			printErrors(parser);
+			const auto payload = envelope.payload;
+			const auto tags	   = payload["tags"].getArray();
+			std::string joined{};
+			for (auto tag: tags) {
+				joined += tag.getString();
+			}
+			uint64_t memberCount{};
+			for (auto [key, member]: payload.getObject()) {
+				memberCount += key.size() > 0 && member.getType() != jsonifier::json_type::unset;
+			}
+			const auto deep		= payload["nested"]["deep"];
+			const auto root		= payload.rawJson();
+			const bool sharesSource = deep.rawJson().data() >= root.data() && deep.rawJson().data() + deep.rawJson().size() <= root.data() + root.size();
+			std::string serialized{};
+			parser.serializeJson(envelope, serialized);
+			raw_envelope broken{};
+			std::string invalid{ R"({"type":"event","payload":{"id" 42}})" };
+			const bool rejected = !parser.parseJson<opts>(broken, invalid) && broken.payload.getType() == jsonifier::json_type::null;
+			return std::make_tuple(parsedOk, payload["id"].getInt(), payload["name"].getString(), joined, tags[1].getString(), memberCount, deep[0].getDouble(),
+				deep[1].getBool(), deep[2].getType() == jsonifier::json_type::null, payload.contains("missing"), sharesSource, serialized == json, rejected);
+		};
+
+		auto test_lazy_document = []() {
+			jsonifier::jsonifier_core<> parser{};
+			std::string json{ R"({ "meta": {"count": 3, "label": "a\"b"}, "items": [ {"id": 7}, {"id": 8}, {"id": 9} ], "values": [1, 2, 3], "skip": {"deep": [[], {}]} })" };
+			auto doc			= parser.iterate(json);
+			const bool parsedOk = doc.valid() && doc.type() == jsonifier::json_type::object;
+			const auto items	= doc["items"];
+			read_route_struct second{};
+			const bool gotSecond = items[1].get(second);
+			int32_t idSum{};
+			for (auto item: items) {
+				idSum += item["id"].get<int32_t>();
+			}
+			std::string keys{};
+			for (auto member: doc) {
+				keys += std::string{ member.key() };
+			}
+			const auto values = doc["values"].get<std::vector<int32_t>>();
+			const auto label  = doc["meta"]["label"].get<std::string>();
+			const bool missing = !doc["meta"]["absent"].valid() && !items[3].valid() && !doc["values"]["count"].valid();
+			return std::make_tuple(parsedOk, gotSecond, second.id, idSum, keys, values.size(), label, std::string{ doc["skip"].rawJson() }, items.size(), missing);
+		};
+
+		auto test_json_pointer_extract = []() {
+			jsonifier::jsonifier_core<> parser{};
+			std::string pretty{ R"({
+	"meta": { "skip": [1, {"price": 0}], "a/b": "slash", "m~n": 5 },
+	"data": {
+		"items": [ {"price": 1.5}, {"price": 2.5}, {"price": 3.5}, {"price": 4.25, "tags": ["x", "y"]} ]
+	}
+})" };
+			std::string minified{ R"({"data":{"items":[{"price":1.5},{"price":2.5},{"price":3.5},{"price":4.25,"tags":["x","y"]}]},"meta":{"a/b":"slash","m~n":5}})" };
+			double price{};
+			const bool gotPretty = jsonifier::extract<"/data/items/3/price">(pretty, price);
+			double minifiedPrice{};
+			const bool gotMinified = jsonifier::extract<"/data/items/3/price", jsonifier::parse_options{ .minified = true }>(minified, minifiedPrice);
+			std::string tag{};
+			const bool gotTag = parser.extract<"/data/items/3/tags/1">(pretty, tag);
+			std::string slash{};
+			int32_t tilde{};
+			const bool gotEscaped = jsonifier::extract<"/meta/a~1b">(minified, slash) && jsonifier::extract<"/meta/m~0n">(pretty, tilde);
+			read_route_struct wrongShape{};
+			double missing{};
+			const bool absent = !jsonifier::extract<"/data/items/4/price">(pretty, missing) && !jsonifier::extract<"/data/items/x">(pretty, missing) &&
+				!parser.extract<"/data/count">(minified, wrongShape) && parser.getErrors().empty();
+			std::string broken{ R"({"data":{"items" [1]}})" };
+			const bool rejected = !parser.extract<"/data/items/0">(broken, missing) && !parser.getErrors().empty();
+			return std::make_tuple(gotPretty, price, gotMinified, minifiedPrice, gotTag, tag, gotEscaped, slash, tilde, absent, rejected);
+		};
+
+		auto test_json_query = []() {
+			jsonifier::jsonifier_core<> parser{};
+			std::string json{ R"({ "user": {"id": 12, "name": "ann"}, "items": [ {"price": 1.5, "sku": "a"}, {"price": 2.5}, {"sku": "c", "price": 4.0} ],
+				"meta": {"a/b": [10, 20, 30]}, "noise": {"items": [{"price": 99}]} })" };
+			jsonifier::json_query query{};
+			std::vector<double> prices{};
+			int32_t userId{};
+			std::vector<int32_t> firstNoise{};
+			read_route_struct user{};
+			std::vector<std::string> skus{};
+			bool added = query.add("$.items[*].price", prices) && query.add("$.user.id", userId) && query.add("$['user']", user);
+			added &= query.add("/meta/a~1b/1", [&](jsonifier::string_view raw) {
+				skus.emplace_back(raw);
+			});
+			added &= query.add("$.items[*].sku", [&](jsonifier::string_view raw) {
+				skus.emplace_back(raw);
+			});
+			added &= query.add("$.*.items[0].price", firstNoise);
+			const bool rejectsBad = !query.add("items.price", userId) && !query.add("$.items[", userId);
+			bool ranOk = parser.query(query, json);
+			printErrors(parser);
+			ranOk &= parser.query(query, json);
+			auto results = std::make_tuple(added, rejectsBad, ranOk, prices, userId, user.id, skus.size(), skus[0], skus[2], firstNoise.size(), false);
+			std::string broken{ R"({"items": [{"price": 1.0} {"price": 2.0}]})" };
+			std::get<10>(results) = !parser.query(query, broken) && !parser.getErrors().empty();
+			return results;
+		};
+
+		auto test_flat_map = []() {
+			jsonifier::jsonifier_core<> parser{};
+			std::string json{ R"({"zeta":1,"alpha":2,"mid":3})" };
+			jsonifier::flat_map<std::string, int32_t> values{};
+			bool parsedOk = parser.parseJson<opts>(values, json);
+			printErrors(parser);
+			std::string serialized{};
+			parser.serializeJson(values, serialized);
+			std::string wide{ "{" };
+			jsonifier::flat_map<std::string, int32_t> large{};
+			for (int32_t x = 0; x < 64; ++x) {
+				wide += (x > 0 ? ",\"key" : "\"key") + std::to_string(x) + "\":" + std::to_string(x);
+				large["key" + std::to_string(x)] = x;
+			}
+			wide += R"(,"esc\"aped":-1})";
+			jsonifier::raw_json_data document{};
+			parsedOk &= parser.parseJson<opts>(document, wide);
+			printErrors(parser);
+			const bool lookups = document["key0"].getInt() == 0 && document["key63"].getInt() == 63 && document["esc\"aped"].getInt() == -1 &&
+				!document.contains("key64") && large.find("key40")->second == 40 && !large.contains("key64");
+			large.erase("key0");
+			const bool erased = !large.contains("key0") && large["key63"] == 63 && large.begin()->first == "key1";
+			return std::make_tuple(parsedOk, serialized, values.begin()->first, lookups, erased, large.size());
+		};
+
+		auto test_unordered_map = []() {
+			jsonifier::jsonifier_core<> parser{};
+			std::string json{ "{" };
+			for (int32_t x = 0; x < 5000; ++x) {
+				json += (x > 0 ? ",\"id" : "\"id") + std::to_string(x) + "\":" + std::to_string(x);
+			}
+			json += R"(,"esc\"aped":-1})";
+			jsonifier::unordered_map<std::string, int32_t> values{};
+			bool parsedOk = parser.parseJson<opts>(values, json);
+			printErrors(parser);
+			const bool lookups = values.size() == 5001 && values.find("id0")->second == 0 && values.find("id4999")->second == 4999 && values["esc\"aped"] == -1 &&
+				!values.contains("id5000");
+			for (int32_t x = 0; x < 5000; x += 2) {
+				values.erase("id" + std::to_string(x));
+			}
+			bool erased = values.size() == 2501;
+			for (int32_t x = 0; x < 5000; ++x) {
+				const auto iter = values.find("id" + std::to_string(x));
+				erased &= (x % 2 == 0) ? iter == values.end() : (iter != values.end() && iter->second == x);
+			}
+			std::string serialized{};
+			parser.serializeJson(values, serialized);
+			jsonifier::unordered_map<std::string, int32_t> reparsed{};
+			parsedOk &= parser.parseJson<opts>(reparsed, serialized);
+			printErrors(parser);
+			return std::make_tuple(parsedOk, lookups, erased, reparsed == values);
+		};
+
+		auto test_string_interning = []() {
+			jsonifier::jsonifier_core<> parser{};
+			auto pool = std::make_shared<jsonifier::string_pool>();
+			parser.setStringPool(pool);
+			std::string json{ R"([{"type":"PushEvent","repo":"a"},{"type":"PushEvent","repo":"b"},{"type":"Push\u0045vent","repo":"a"}])" };
+			std::vector<interned_event> events{};
+			bool parsedOk = parser.parseJson<opts>(events, json);
+			printErrors(parser);
+			const bool shared = events.size() == 3 && events[0].type.data() == events[1].type.data() && events[0].type.data() == events[2].type.data() &&
+				events[0].repo.data() == events[2].repo.data() && events[0].repo != events[1].repo;
+			std::string keysJson{ R"({"alpha":1,"beta":2})" };
+			jsonifier::unordered_map<jsonifier::interned_string, int32_t> keyed{};
+			std::unordered_map<jsonifier::interned_string, int32_t> stdKeyed{};
+			parsedOk &= parser.parseJson<opts>(keyed, keysJson) && parser.parseJson<opts>(stdKeyed, keysJson);
+			printErrors(parser);
+			const bool keysShared = keyed.find("alpha")->first.data() == stdKeyed.find(jsonifier::interned_string{ "alpha", *pool })->first.data();
+			std::string serialized{};
+			parser.serializeJson(events[2], serialized);
+			return std::make_tuple(parsedOk, shared, keysShared, pool->size(), serialized);
+		};
+
+		auto test_string_enum = []() {
+			jsonifier::jsonifier_core<> parser{};
+			std::string json{ R"({"kind":"IssueEvent","history":["PushEvent","watch_event",4,"PullRequestEvent"]})" };
+			kind_event event{};
+			bool parsedOk = parser.parseJson<opts>(event, json);
+			printErrors(parser);
+			const bool decoded = event.kind == event_kind::issue_event && event.history.size() == 4 && event.history[1] == event_kind::watch_event &&
+				event.history[2] == event_kind::pull_request_event && event.history[3] == event_kind::pull_request_event;
+			std::string serialized{};
+			event.history.emplace_back(static_cast<event_kind>(7));
+			parser.serializeJson(event, serialized);
+			std::string unknownJson{ R"({"kind":"PushEvents","history":[]})" };
+			kind_event unknown{};
+			const bool rejected = !parser.parseJson<opts>(unknown, unknownJson) && !parser.getErrors().empty();
+			return std::make_tuple(parsedOk, decoded, serialized, rejected);
+		};
+
+		auto test_variant_dispatch = []() {
+			jsonifier::jsonifier_core<> parser{};
+			std::string taggedJson{
+				R"([{"number":7,"type":"IssueEvent","title":"bug"},{"type":"WatchEvent","action":"started"},{"ref":"main","size":3,"type":"PushEvent"}])"
+			};
+			std::vector<tagged_payload> tagged{};
+			bool parsedOk = parser.parseJson<opts>(tagged, taggedJson);
+			printErrors(parser);
+			const bool taggedOk = tagged.size() == 3 && tagged[0].index() == 1 && std::get<1>(tagged[0]).number == 7 && tagged[1].index() == 2 &&
+				std::get<2>(tagged[1]).action == "started" && tagged[2].index() == 0 && std::get<0>(tagged[2]).size == 3;
+			std::string inferredJson{ R"([{"ref":"dev","size":9},{"title":"t","number":2},{"action":"x"},"plain",{}])" };
+			std::vector<inferred_payload> inferred{};
+			parsedOk &= parser.parseJson<opts>(inferred, inferredJson);
+			printErrors(parser);
+			const bool inferredOk = inferred.size() == 5 && inferred[0].index() == 1 && std::get<1>(inferred[0]).ref == "dev" && inferred[1].index() == 2 &&
+				std::get<2>(inferred[1]).number == 2 && inferred[2].index() == 0 && inferred[3].index() == 3 && inferred[4].index() == 0;
+			std::string unknownJson{ R"([{"type":"ForkEvent"}])" };
+			const bool rejected = !parser.parseJson<opts>(tagged, unknownJson) && !parser.getErrors().empty();
+			return std::make_tuple(parsedOk, taggedOk, inferredOk, rejected);
+		};
+
+		auto test_error_records = []() {
+			static constexpr jsonifier::parse_options failFastOpts{ .partialRead = partial, .knownOrder = knownOrder, .failFast = true };
+			jsonifier::jsonifier_core<> parser{};
+			BasicStruct obj{};
+			bool failed{};
+			{
+				std::string json{ R"({"i":42,"d":3.14 "str":"x","arr":[1,2,3]})" };
+				failed = !parser.parseJson<failFastOpts>(obj, json);
+			}
+			const auto& errors		   = parser.getErrors();
+			const bool single		   = errors.size() == 1 && static_cast<jsonifier::internal::parse_statuses>(errors.front()) == jsonifier::internal::parse_statuses::missing_comma;
+			const std::string rendered = errors.empty() ? std::string{} : std::string{ errors.front().reportError().data(), errors.front().reportError().size() };
+			const bool lazy			   = rendered.find("Error of Class: parsing") == 0 && rendered.find("The Values: ") != std::string::npos &&
+				errors.front().getErrorIndex() == 17 && errors.front().getErrorClass() == jsonifier::internal::status_classes::parsing;
+			return std::make_tuple(failed, single, lazy);
+		};
+
+		auto test_serialize_in_place = []() {
+			jsonifier::jsonifier_core<> parser{};
+			BasicStruct obj{ 42, 3.14, "Hello", { 1, 2, 3 } };
+			std::string output(4096, ' ');
+			const char* before = output.data();
+			parser.serializeJson(obj, output);
+			const bool inPlace = output.data() == before;
+			std::vector<char> scalar{};
+			parser.serializeJson(int64_t{ -1234567890123 }, scalar);
+			std::vector<event_kind> kinds(512, event_kind::pull_request_event);
+			std::string grown{};
+			parser.serializeJson(kinds, grown);
+			const bool grownOk = grown.size() == 2 + 512 * 19 - 1 && grown.starts_with(R"(["PullRequestEvent","PullRequestEvent")");
+			return std::make_tuple(output, inPlace, std::string{ scalar.data(), scalar.size() }, grownOk);
+		};
+
+		auto test_streaming_serialize = []() {
+			static constexpr jsonifier::serialize_options chunked{ .chunkSize = 256 };
+			static constexpr jsonifier::serialize_options prettyChunked{ .prettify = true, .chunkSize = 256 };
+			jsonifier::jsonifier_core<> parser{};
+			std::vector<Thing> things(64);
+			std::map<std::string, std::vector<int32_t>> groups{ { "a", std::vector<int32_t>(300, 7) }, { "b", {} } };
+			std::string expected{};
+			std::string expectedPretty{};
+			parser.serializeJson(things, expected);
+			parser.serializeJson<jsonifier::serialize_options{ .prettify = true }>(things, expectedPretty);
+			std::string streamed{};
+			uint64_t chunks{};
+			uint64_t largestChunk{};
+			auto sink = [&](const char* data, uint64_t length) {
+				streamed.append(data, length);
+				++chunks;
+				largestChunk = std::max(largestChunk, length);
+			};
+			parser.serializeJson<chunked>(things, sink);
+			const bool matches = streamed == expected && chunks > 1 && largestChunk < 256;
+			streamed.clear();
+			parser.serializeJson<prettyChunked>(things, sink);
+			const bool prettyMatches = streamed == expectedPretty;
+			std::string expectedGroups{};
+			parser.serializeJson(groups, expectedGroups);
+			std::ostringstream stream{};
+			const bool streamOk = parser.serializeJson<chunked>(groups, stream);
+			return std::make_tuple(matches, prettyMatches, streamOk, stream.str() == expectedGroups);
+		};
+
+		auto test_segmented_serialize = []() {
+			jsonifier::jsonifier_core<> parser{};
+			std::vector<Thing> things(64);
+			std::string expected{};
+			parser.serializeJson(things, expected);
+			jsonifier::segmented_buffer<1024> segments{};
+			parser.serializeJson(things, segments);
+			bool bounded{ true };
+			for (uint64_t x = 0; x < segments.segmentCount(); ++x) {
+				bounded &= segments.iovecs()[x].iov_len <= jsonifier::segmented_buffer<1024>::segmentSize;
+			}
+			std::string joined{};
+			segments.copyTo(joined);
+			const bool matches = joined == expected && segments.size() == expected.size() && segments.segmentCount() > 1;
+			std::vector<std::string> big{ std::string(4000, 'x') };
+			std::string expectedBig{};
+			parser.serializeJson(big, expectedBig);
+			parser.serializeJson(big, segments);
+			segments.copyTo(joined);
+			return std::make_tuple(matches, bounded, joined == expectedBig);
+		};
+
+		auto test_measure_json = []() {
+			static constexpr jsonifier::serialize_options pretty{ .prettify = true };
+			jsonifier::jsonifier_core<> parser{};
+			std::vector<Thing> things(8);
+			things[1].optional = V3{ -1.5, 1e300, 0.1 };
+			things[2].sptr.reset();
+			things[3].c = '"';
+			things[4].i = std::numeric_limits<int32_t>::min();
+			std::vector<std::string> strings{ "", std::string(1, '\0'), std::string(200, 'x') + "\"\n\t" + std::string(70, '\\') + std::string(3, '\0') + "\x1f\x7f",
+				"\xc3\xa9t\xc3\xa9" };
+			std::tuple<std::vector<int64_t>, std::vector<uint64_t>, std::vector<float>> numbers{ { std::numeric_limits<int64_t>::min(), -1, 0, 9, 10, 99999 },
+				{ std::numeric_limits<uint64_t>::max(), 1000000000000ULL }, { 0.1f, -3.25f, 1e-20f } };
+			std::map<std::string, std::vector<std::string>> groups{ { "a", strings }, { "empty", {} } };
+			auto exact = [&](auto& value) {
+				std::string output{};
+				parser.serializeJson(value, output);
+				std::string prettyOutput{};
+				parser.serializeJson<pretty>(value, prettyOutput);
+				return parser.measureJson(value) == output.size() && parser.measureJson<pretty>(value) == prettyOutput.size();
+			};
+			const bool measured = exact(things) && exact(strings) && exact(numbers) && exact(groups);
+			std::string expected{};
+			parser.serializeJson(things, expected);
+			std::string allocatedOnce{};
+			const bool written = parser.serializeJson(things, allocatedOnce, parser.measureJson(things));
+			return std::make_tuple(measured, written, allocatedOnce == expected);
+		};
+
+		auto test_parallel_serialize = []() {
+			static constexpr jsonifier::serialize_options parallel{ .parallelThreshold = 16, .parallelThreads = 4 };
+			static constexpr jsonifier::serialize_options prettyParallel{ .prettify = true, .parallelThreshold = 16, .parallelThreads = 4 };
+			jsonifier::jsonifier_core<> parser{};
+			std::vector<Thing> things(100);
+			for (uint64_t x = 0; x < things.size(); ++x) {
+				things[x].i = static_cast<int32_t>(x);
+			}
+			std::map<std::string, std::vector<int32_t>> groups{};
+			for (int32_t x = 0; x < 50; ++x) {
+				groups["key" + std::to_string(x)] = std::vector<int32_t>(static_cast<uint64_t>(x), x);
+			}
+			std::vector<bool> flags(1000);
+			for (uint64_t x = 0; x < flags.size(); x += 3) {
+				flags[x] = true;
+			}
+			auto identical = [&](auto& value) {
+				std::string sequential{};
+				std::string concurrent{};
+				parser.serializeJson(value, sequential);
+				parser.serializeJson<parallel>(value, concurrent);
+				std::string prettySequential{};
+				std::string prettyConcurrent{};
+				parser.serializeJson<jsonifier::serialize_options{ .prettify = true }>(value, prettySequential);
+				parser.serializeJson<prettyParallel>(value, prettyConcurrent);
+				return sequential == concurrent && prettySequential == prettyConcurrent;
+			};
+			return std::make_tuple(identical(things), identical(groups), identical(flags));
+		};
+
+		auto test_cached_fragments = []() {
+			static constexpr jsonifier::serialize_options pretty{ .prettify = true };
+			jsonifier::jsonifier_core<> parser{};
+			std::vector<cached_state> states(2);
+			std::vector<plain_state> plain(2);
+			states[0].history = std::vector<int32_t>{ 1, 2, 3 };
+			plain[0].history  = { 1, 2, 3 };
+			auto matches = [&]<jsonifier::serialize_options options>() {
+				std::string cachedOutput{};
+				std::string plainOutput{};
+				parser.serializeJson<options>(states, cachedOutput);
+				parser.serializeJson<options>(plain, plainOutput);
+				return cachedOutput == plainOutput;
+			};
+			bool consistent = matches.template operator()<jsonifier::serialize_options{}>();
+			const bool clean = !states[0].history.isDirty() && !states[1].detail.isDirty();
+			consistent &= matches.template operator()<jsonifier::serialize_options{}>();
+			states[1].history.mutate().push_back(42);
+			plain[1].history.push_back(42);
+			const bool dirtied = states[1].history.isDirty() && !states[0].history.isDirty();
+			consistent &= matches.template operator()<jsonifier::serialize_options{}>();
+			consistent &= matches.template operator()<pretty>();
+			consistent &= matches.template operator()<jsonifier::serialize_options{}>();
+			std::string measured{};
+			parser.serializeJson(states, measured);
+			consistent &= parser.measureJson(states) == measured.size();
+			cached_state parsed{};
+			std::string json{ R"({"tick":7,"history":[4,5],"detail":{"a":1.5,"b":"x"}})" };
+			parser.parseJson<opts>(parsed, json);
+			return std::make_tuple(consistent, clean, dirtied, parsed.history->size() == 2 && parsed.history.isDirty() && parsed.detail->b == "x");
+		};
+
+		auto test_json_fragment = []() {
+			jsonifier::jsonifier_core<> parser{};
+			std::string json{ R"({"type":"forward","payload":{"nested":[1,2,{"deep":"yes"}],"n":null}})" };
+			fragment_envelope envelope{};
+			parser.parseJson<opts>(envelope, json);
+			const bool captured = envelope.payload == R"({"nested":[1,2,{"deep":"yes"}],"n":null})" && !envelope.payload.owning() &&
+				envelope.payload.data() >= json.data() && envelope.payload.data() < json.data() + json.size();
+			std::string output{};
+			parser.serializeJson(envelope, output);
+			const bool verbatim = output == json && parser.measureJson(envelope) == output.size();
+			envelope.payload.detach();
+			json.assign(json.size(), ' ');
+			const bool detached = envelope.payload.owning() && envelope.payload.view().starts_with(R"({"nested")");
+			std::vector<fragment_envelope> envelopes(3);
+			const std::string large{ "[" + std::string(2000, '1') + "]" };
+			envelopes[1].payload = jsonifier::json_fragment{ std::string_view{ large } };
+			std::string expected{};
+			parser.serializeJson(envelopes, expected);
+			jsonifier::segmented_buffer<1024> segments{};
+			parser.serializeJson(envelopes, segments);
+			bool referenced{};
+			for (uint64_t x = 0; x < segments.segmentCount(); ++x) {
+				referenced |= segments.iovecs()[x].iov_base == large.data();
+			}
+			std::string joined{};
+			segments.copyTo(joined);
+			return std::make_tuple(captured, verbatim, detached, referenced && joined == expected);
+		};
+
+		auto test_fixed_layout = []() {
+			jsonifier::jsonifier_core<> parser{};
+			market_tick tick{ 1700000000123, 7, 101.25, 0.5f, -3, true, 'x', tick_side::ask };
+			std::string output{};
+			parser.serializeJson(tick, output);
+			const bool matches = output == R"({"timestamp":1700000000123,"venue":7,"price":101.25,"size":0.5,"delta":-3,"active":true,"flag":"x","side":1})";
+			market_tick extreme{ std::numeric_limits<int64_t>::min(), std::numeric_limits<uint32_t>::max(), -std::numeric_limits<double>::denorm_min(),
+				-std::numeric_limits<float>::max(), std::numeric_limits<int32_t>::min(), false, '"', tick_side::bid };
+			parser.serializeJson(extreme, output);
+			const bool bounded = output.size() <= jsonifier::maxSerializedSize<market_tick>;
+			std::array<char, jsonifier::fixedLayoutCapacity<market_tick>> stackBuffer{};
+			const bool onStack = parser.serializeJson(extreme, stackBuffer) == output;
+			extreme.flag = 'z';
+			parser.serializeJson(extreme, output);
+			market_tick parsed{};
+			parser.parseJson<opts>(parsed, output);
+			return std::make_tuple(matches, bounded && onStack, parsed.timestamp == extreme.timestamp && parsed.flag == 'z' && parsed.delta == extreme.delta,
+				parsed.venue == extreme.venue && parsed.size == extreme.size);
+		};
+
+		auto test_batch_numeric_arrays = []() {
+			static constexpr jsonifier::serialize_options chunked{ .chunkSize = 256 };
+			jsonifier::jsonifier_core<> parser{};
+			auto identical = [&]<typename value_type>(std::vector<value_type> values) {
+				for (value_type x = 1, power = 1; x < std::numeric_limits<value_type>::max() / 10; x *= 10, ++power) {
+					values.insert(values.end(), { static_cast<value_type>(x - 1), x, static_cast<value_type>(x + power) });
+					if constexpr (std::is_signed_v<value_type>) {
+						values.insert(values.end(), { static_cast<value_type>(1 - x), static_cast<value_type>(-x) });
+					}
+				}
+				values.insert(values.end(), { std::numeric_limits<value_type>::max(), std::numeric_limits<value_type>::lowest(), value_type{} });
+				std::string expected{ "[" };
+				std::string expectedPretty{ "[\n" };
+				for (uint64_t x = 0; x < values.size(); ++x) {
+					std::string element{};
+					parser.serializeJson(values[x], element);
+					expected += (x > 0 ? "," : "") + element;
+					expectedPretty += (x > 0 ? ",\n   " : "   ") + element;
+				}
+				expected += "]";
+				expectedPretty += "\n]";
+				std::string output{};
+				parser.serializeJson(values, output);
+				std::string pretty{};
+				parser.serializeJson<jsonifier::serialize_options{ .prettify = true }>(values, pretty);
+				std::string streamed{};
+				auto sink = [&](const char* data, uint64_t length) {
+					streamed.append(data, length);
+				};
+				parser.serializeJson<chunked>(values, sink);
+				return output == expected && pretty == expectedPretty && streamed == expected && parser.measureJson(values) == expected.size();
+			};
+			const bool integers = identical(std::vector<int64_t>{}) && identical(std::vector<uint64_t>{}) && identical(std::vector<int32_t>{ 5, -5, 42 });
+			std::vector<int64_t> small(1000);
+			for (uint64_t x = 0; x < small.size(); ++x) {
+				small[x] = static_cast<int64_t>(x % 100);
+			}
+			const bool smallOk = identical(small);
+			std::vector<double> doubles{ 0.1, -2.5, 1e300, -5e-324, 3.141592653589793, 1.0 };
+			std::vector<float> floats{ 0.5f, -1.25f, 3.4028234663852886e+38f, 1e-10f, 7.0f };
+			return std::make_tuple(integers, smallOk, identical(doubles), identical(floats));
+		};
+
+		auto test_batch_numeric_parse = []() {
+			jsonifier::jsonifier_core<> parser{};
+			auto matchesScalar = [&]<typename value_type>(const std::vector<std::string>& tokens, std::string_view separator) {
+				std::string json{ "[" };
+				std::vector<value_type> expected{};
+				for (uint64_t x = 0; x < tokens.size(); ++x) {
+					json += (x > 0 ? std::string{ separator } : std::string{}) + tokens[x];
+					value_type element{};
+					parser.parseJson<opts>(element, tokens[x]);
+					expected.emplace_back(element);
+				}
+				json += "]";
+				std::vector<value_type> parsed(3);
+				return parser.parseJson<opts>(parsed, json) && parsed == expected;
+			};
+			std::vector<std::string> floats{};
+			std::vector<std::string> integers{};
+			for (int32_t x = 0; x < 400; ++x) {
+				floats.emplace_back(std::to_string(x * 7919 % 1000) + "." + std::to_string(x * 104729 % 100000000));
+				integers.emplace_back(std::to_string(static_cast<int64_t>(x) * 982451653LL * (x % 2 ? -1 : 1)));
+			}
+			floats.insert(floats.begin() + 100, { "-65.613616999999977", "1.5e38", "4.9e-324", "0.1e1", "-0", "123456789012345678901234567890", "2.5E-3", "7" });
+			integers.insert(integers.begin() + 100, { "9223372036854775807", "-9223372036854775808", "0", "-0", "123" });
+			const bool minified = matchesScalar.template operator()<double>(floats, ",") && matchesScalar.template operator()<float>(floats, ",") &&
+				matchesScalar.template operator()<int64_t>(integers, ",") && matchesScalar.template operator()<int32_t>(integers, ",");
+			const bool spaced = matchesScalar.template operator()<double>(floats, ", ") && matchesScalar.template operator()<int64_t>(integers, " ,\n  ");
+			numeric_series series{};
+			std::string json{ R"({"values":[)" };
+			for (int32_t x = 0; x < 200; ++x) {
+				json += std::to_string(x) + ".5,";
+			}
+			json += R"(1.25],"stamps":[1700000000000,1700000000001,1700000000002,1700000000003,1700000000004,1700000000005,1700000000006,1700000000007,1700000000008],"ids":[)";
+			for (int32_t x = 0; x < 200; ++x) {
+				json += std::to_string(x * 1000003) + ",";
+			}
+			json += "18446744073709551615]}";
+			const bool nested = parser.parseJson<opts>(series, json) && series.values.size() == 201 && series.values[199] == 199.5 && series.values.back() == 1.25 &&
+				series.stamps.size() == 9 && series.stamps.back() == 1700000000008 && series.ids.size() == 201 && series.ids[7] == 7000021 &&
+				series.ids.back() == 18446744073709551615ULL;
+			std::vector<int64_t> rejected{};
+			std::string padding{};
+			for (int32_t x = 0; x < 100; ++x) {
+				padding += std::to_string(x) + ",";
+			}
+			const bool errors = !parser.parseJson<opts>(rejected, "[" + padding + "1,,2]") && !parser.parseJson<opts>(rejected, "[" + padding + "01,2]") &&
+				!parser.parseJson<opts>(rejected, "[" + padding + "1,x]") && !parser.parseJson<opts>(series.ids, "[" + padding + "-1,2]") &&
+				!parser.parseJson<opts>(rejected, "[" + padding + "1,2");
+			return std::make_tuple(minified, spaced, nested, errors);
+		};
+
 		std::cout << "Unit Tests, " << testTypePartial<partial> << testTypeKnownOrder<knownOrder> << ": " << std::endl;
 
 		rt_ut::unit_test<"Partial Basic", true>::assert_eq(std::make_tuple(42, 3.14, std::string{ "Hello" }, 1u), test_partial_basic);
@@ -1117,6 +1939,45 @@ namespace unit_tests {
 		rt_ut::unit_test<"Optional Value", true>::assert_eq(true, test_optional_value);
 		rt_ut::unit_test<"Map", true>::assert_eq(std::make_tuple(4, 7, 12), test_map);
 		rt_ut::unit_test<"Dummy Data Vector", true>::assert_eq(std::make_tuple(std::uint64_t{ 4 }, true), test_dummy_data);
+		rt_ut::unit_test<"Prettified Layout", true>::assert_eq(
+			std::make_tuple(12, std::string{ "indented" }, std::uint64_t{ 3 }, true, 7, std::string{ "mixed" }, 2.5, 1, true), test_prettified_layout);
+		rt_ut::unit_test<"Detect Minified", true>::assert_eq(std::make_tuple(true, true, std::string{ "detected" }, std::uint64_t{ 4 }, true, true), test_detect_minified);
+		rt_ut::unit_test<"Adaptive Read", true>::assert_eq(std::make_tuple(true, 17, 23, true, true, true), test_adaptive_read);
+		rt_ut::unit_test<"Raw Json Views", true>::assert_eq(std::make_tuple(true, int64_t{ 42 }, jsonifier::string{ "a\"b" }, std::string{ "xyz" }, jsonifier::string{ "y" },
+																std::uint64_t{ 4 }, 1.5, true, true, false, true, true, true),
+			test_raw_json_views);
+		rt_ut::unit_test<"Shared Key Order Learning", true>::assert_eq(std::make_tuple(true, 1, 2, 3, true, true), test_shared_key_order_learning);
+		rt_ut::unit_test<"Shared Key Order Profile", true>::assert_eq(std::make_tuple(std::string{ R"({"keys":["c","a","b"]})" }, true, true, 321, 654),
+			test_shared_key_order_profile);
+		rt_ut::unit_test<"Lazy Document", true>::assert_eq(std::make_tuple(true, true, 8, 24, std::string{ "metaitemsvaluesskip" }, std::uint64_t{ 3 }, std::string{ "a\"b" },
+															  std::string{ R"({"deep": [[], {}]})" }, std::uint64_t{ 3 }, true),
+			test_lazy_document);
+		rt_ut::unit_test<"Json Pointer Extract", true>::assert_eq(
+			std::make_tuple(true, 4.25, true, 4.25, true, std::string{ "y" }, true, std::string{ "slash" }, 5, true, true), test_json_pointer_extract);
+		rt_ut::unit_test<"Json Query", true>::assert_eq(std::make_tuple(true, true, true, std::vector<double>{ 1.5, 2.5, 4.0 }, 12, 12, std::uint64_t{ 6 }, std::string{ "\"a\"" },
+														  std::string{ "20" }, std::uint64_t{ 1 }, true),
+			test_json_query);
+		rt_ut::unit_test<"Flat Map", true>::assert_eq(
+			std::make_tuple(true, std::string{ R"({"zeta":1,"alpha":2,"mid":3})" }, std::string{ "zeta" }, true, true, std::uint64_t{ 63 }), test_flat_map);
+		rt_ut::unit_test<"Unordered Map", true>::assert_eq(std::make_tuple(true, true, true, true), test_unordered_map);
+		rt_ut::unit_test<"String Interning", true>::assert_eq(
+			std::make_tuple(true, true, true, std::uint64_t{ 5 }, std::string{ R"({"type":"PushEvent","repo":"a"})" }), test_string_interning);
+		rt_ut::unit_test<"String Enum", true>::assert_eq(
+			std::make_tuple(true, true, std::string{ R"({"kind":"IssueEvent","history":["PushEvent","watch_event","PullRequestEvent","PullRequestEvent",7]})" }, true),
+			test_string_enum);
+		rt_ut::unit_test<"Variant Dispatch", true>::assert_eq(std::make_tuple(true, true, true, true), test_variant_dispatch);
+		rt_ut::unit_test<"Error Records", true>::assert_eq(std::make_tuple(true, true, true), test_error_records);
+		rt_ut::unit_test<"Serialize In Place", true>::assert_eq(
+			std::make_tuple(std::string{ R"({"i":42,"d":3.14,"str":"Hello","arr":[1,2,3]})" }, true, std::string{ "-1234567890123" }, true), test_serialize_in_place);
+		rt_ut::unit_test<"Streaming Serialize", true>::assert_eq(std::make_tuple(true, true, true, true), test_streaming_serialize);
+		rt_ut::unit_test<"Segmented Serialize", true>::assert_eq(std::make_tuple(true, true, true), test_segmented_serialize);
+		rt_ut::unit_test<"Measure Json", true>::assert_eq(std::make_tuple(true, true, true), test_measure_json);
+		rt_ut::unit_test<"Parallel Serialize", true>::assert_eq(std::make_tuple(true, true, true), test_parallel_serialize);
+		rt_ut::unit_test<"Cached Fragments", true>::assert_eq(std::make_tuple(true, true, true, true), test_cached_fragments);
+		rt_ut::unit_test<"Json Fragment", true>::assert_eq(std::make_tuple(true, true, true, true), test_json_fragment);
+		rt_ut::unit_test<"Fixed Layout", true>::assert_eq(std::make_tuple(true, true, true, true), test_fixed_layout);
+		rt_ut::unit_test<"Batch Numeric Arrays", true>::assert_eq(std::make_tuple(true, true, true, true), test_batch_numeric_arrays);
+		rt_ut::unit_test<"Batch Numeric Parse", true>::assert_eq(std::make_tuple(true, true, true, true), test_batch_numeric_parse);
 	}
 
 	inline static void unitTests() {